@@ -1246,6 +1246,11 @@
   #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
   #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
 
+  //#define MPC_FEED_FORWARD                          // Heat for the extrusion rate of the planned moves instead of the current one.
+  #if ENABLED(MPC_FEED_FORWARD)
+    #define MPC_FEED_FORWARD_TIME 2.0f                // (s) Planned moves to look ahead. Longer heats up earlier for fast extrusion.
+  #endif
+
   #define MPC_TUNING_POS { X_CENTER, Y_CENTER, 1.0f } // (mm) M306 Autotuning position, ideally bed center at first layer height.
   #define MPC_TUNING_END_Z 10.0f                      // (mm) M306 Autotuning final Z position.
 #endif
@@ -1943,6 +1948,14 @@
   #define JUNCTION_DEVIATION_MM 0.013 // (mm) Distance from real junction edge
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  //#define JD_CORNER_BLENDING        // Limit speed by the curvature of a run of short segments that
+                                      // turn the same way, instead of by each single corner.
+                                      // Vertices of the run may deviate more than JUNCTION_DEVIATION_MM.
+  #if ENABLED(JD_CORNER_BLENDING)
+    #define JD_BLEND_BLOCKS       4   // Corners in a run (2-8)
+    #define JD_BLEND_SEGMENT_MM   2.0 // (mm) Longest segment to count as part of a curve
+    #define JD_BLEND_MAX_FACTOR   1.5 // Most a vertex speed can be raised, as a multiple of its own limit (1-4)
+  #endif
 #endif
 
 /**
@@ -1950,6 +1963,7 @@
  *
  * This option eliminates vibration during printing by fitting a Bézier
  * curve to move acceleration, producing much smoother direction changes.
+ * Also applies to FT_MOTION, so it can be combined with input shaping.
  *
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
@@ -2365,6 +2379,19 @@
 #endif
 //#define EXTRA_PROBING    1
 
+/**
+ * Probe Sweep
+ * Speed up probing a whole grid with G29. The raise after each point is
+ * queued without waiting, so the travel to the next point follows right
+ * behind it. With MULTIPLE_PROBING 2 the slow probe backs off from the fast
+ * touch by a few times the measured discrepancy instead of the full
+ * Z_CLEARANCE_MULTI_PROBE. UBL probes the nearest point to the last one.
+ */
+//#define PROBE_SWEEP
+#if ENABLED(PROBE_SWEEP)
+  #define PROBE_SWEEP_BACKOFF_MIN 1.0 // (mm) Least back-off before the slow probe
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -3127,6 +3154,14 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * Get the leveling correction of each segment of a move from the mesh cells
+   * that the move crosses, instead of looking up the mesh for every segment.
+   * For segmented moves with MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR.
+   * (UBL already does this.)
+   */
+  //#define LEVELING_CORRECTION_STREAM
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -3174,6 +3209,17 @@
     // Default is to maintain the height of the nearest edge.
     //#define EXTRAPOLATE_BEYOND_GRID
 
+    //
+    // Adaptive grid probing. G29 probes a coarse grid first, then probes the
+    // rest of a cell only where the bed deviates from the coarse grid.
+    // Use 'G29 U0' to probe every point. Not for BD_SENSOR_PROBE_NO_STOP.
+    //
+    //#define ABL_ADAPTIVE_GRID
+    #if ENABLED(ABL_ADAPTIVE_GRID)
+      #define ABL_ADAPTIVE_STRIDE      2    // Probe every Nth point on the first pass
+      #define ABL_ADAPTIVE_TOLERANCE   0.02 // (mm) Largest error at a cell center to skip the rest of the cell
+    #endif
+
     //
     // Subdivision of the grid by Catmull-Rom method.
     // Synthesizes intermediate points to produce a more detailed mesh.
@@ -3182,6 +3228,9 @@
     #if ENABLED(ABL_BILINEAR_SUBDIVISION)
       // Number of subdivisions between probe points
       #define BILINEAR_SUBDIVISIONS 3
+
+      // Store the subdivided grid as int16 microns, built one row at a time from idle() while leveling is off
+      //#define COMPACT_SUBDIVIDED_MESH
     #endif
 
   #endif
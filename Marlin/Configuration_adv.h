@@ -169,6 +169,18 @@
   #define REDUNDANT_SH_C_COEFF               0 // Steinhart-Hart C coefficient
 #endif
 
+/**
+ * Dense Thermistor Tables
+ * Convert hotend, bed, and chamber thermistor readings with an evenly spaced table instead of
+ * searching the thermistor table or calling log() for a custom thermistor on every reading.
+ * The tables are built at startup and again when M305 changes a custom thermistor.
+ * Uses 4 * (THERMISTOR_DENSE_ENTRIES + 1) bytes of RAM per sensor.
+ */
+//#define THERMISTOR_DENSE_TABLE
+#if ENABLED(THERMISTOR_DENSE_TABLE)
+  #define THERMISTOR_DENSE_ENTRIES 128  // Table points (a power of 2, 32-1024). Use more for less error.
+#endif
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -502,6 +514,16 @@
 // Enable for M105 to include ADC values read from temperature sensors.
 //#define SHOW_TEMP_ADC_VALUES
 
+/**
+ * Continuous ADC Sampling
+ * The ADC scans all the sensor pins in the background (by DMA or hardware burst mode)
+ * and oversamples them, so the Temperature ISR no longer starts and reads one sensor
+ * per tick. The ISR still runs at the same rate for heater PWM and its other tasks.
+ * Supported on STM32F1 (maple), SAMD51, and LPC176x.
+ * Not compatible with ADC keypads (ZONESTAR_LCD), FILAMENT_WIDTH_SENSOR, or POWER_MONITOR_*.
+ */
+//#define CONTINUOUS_ADC_SAMPLING
+
 /**
  * High Temperature Thermistor Support
  *
@@ -1168,6 +1190,9 @@
 
   //#define FT_MOTION_MENU                        // Provide a MarlinUI menu to set M493 parameters
 
+  //#define FTM_CURVES                            // Run G2/G3 arcs (in parts up to 45°) and G5 curves as single planner blocks
+                                                  // while FT Motion is on and bed leveling is off
+
   /**
    * Advanced configuration
    */
@@ -1214,6 +1239,25 @@
                                                   //   3HEI     : FTM_RATIO * 2
 #endif
 
+/**
+ * Step Compression -- EXPERIMENTAL
+ *
+ * Replace the Bresenham / trapezoid logic of the Stepper ISR with step sequences
+ * computed in advance by the main loop. Each axis gets a queue of compressed
+ * (interval, count, add) sequences, so the ISR only pops sequences and pulses pins.
+ * Steps are placed at their ideal times (within STEP_COMPRESSION_MAX_ERROR) and
+ * all the square roots and divisions run outside of the interrupt.
+ *
+ * Not compatible with LIN_ADVANCE, S_CURVE_ACCELERATION, Input Shaping or FT_MOTION.
+ */
+//#define STEP_COMPRESSION
+#if ENABLED(STEP_COMPRESSION)
+  #define STEP_COMPRESSION_QUEUE_SIZE    32       // Step sequences queued per axis. (Power of 2)
+  #define STEP_COMPRESSION_WINDOW        64       // Step times considered for each sequence fit
+  #define STEP_COMPRESSION_MAX_ERROR     10       // (µs) Maximum deviation of a step from its ideal time
+  #define STEP_COMPRESSION_LEAD_MS        8       // (ms) How far ahead of the ISR steps are computed
+#endif
+
 /**
  * Input Shaping -- EXPERIMENTAL
  *
@@ -1585,6 +1629,13 @@
  */
 #define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Compute the acceleration / deceleration steps of each block with integer math on step rates
+ * instead of floats. Recommended for boards without an FPU (AVR, STM32F1) where floating point
+ * divides and square roots are emulated and limit the number of short segments per second.
+ */
+//#define TRAPEZOID_INTEGER_MATH
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1910,6 +1961,16 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  /**
+   * Read the print file ahead in whole blocks with multi-block transfers, topping up
+   * the buffer in idle time. Reading G-code then becomes a plain memory read.
+   * Uses SD_READ_AHEAD_BLOCKS * 512 bytes of SRAM.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 4          // Number of 512-byte blocks to buffer (2, 4, 8, 16, 32)
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE false   //  <-- changed: Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -2732,7 +2793,9 @@
   #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  //#define ARC_CHORD_TOLERANCE 0.005 // (mm) Use the radius to choose the segment length, keeping each segment this close to the arc
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
+  //#define ARC_STREAMING             // Queue arc segments from the main loop as the planner frees up, instead of waiting in G2/G3
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
 #endif
@@ -2744,6 +2807,22 @@
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
 #endif
 
+/**
+ * Linearized Kinematics
+ *
+ * On DELTA, SCARA, and POLAR machines every segment of a move needs its own
+ * inverse kinematics, which can limit the top speed before the mechanics do.
+ * With this option exact kinematics are only done every few segments, and the
+ * segments in between follow the straight joint-space chord between those exact
+ * points. The exact joints at the middle of each span are checked against the
+ * chord, and the span length adapts to keep that error within tolerance.
+ */
+//#define KINEMATIC_IK_LINEARIZE
+#if ENABLED(KINEMATIC_IK_LINEARIZE)
+  #define KINEMATIC_IK_TOLERANCE 0.001  // (mm/°) Greatest joint error between exact points
+  #define KINEMATIC_IK_MAX_SPAN      8  // Most segments from one exact point to the next
+#endif
+
 /**
  * Direct Stepping
  *
@@ -2753,6 +2832,17 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * Allow G6 pages in between regular G-code moves without a wait. The planner
+   * position follows each page, and the moves on either side slow to a stop at it.
+   * A G6 waits for its page to finish arriving. (Cartesian machines only.)
+   */
+  //#define DIRECT_STEPPING_STREAM
+  #if ENABLED(DIRECT_STEPPING_STREAM)
+    #define DIRECT_STEPPING_PAGE_TIMEOUT 1000 // (ms) Longest wait for a page before G6 gives up
+  #endif
+#endif
 
 /**
  * G38 Probe Target
@@ -4170,6 +4260,14 @@
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
 #endif
 
+/**
+ * Print pre-tokenized binary G-code (*.GCB) files from media. Commands are stored
+ * as letter, code and float32 parameters, so no text parsing is done when printing.
+ * Convert files with buildroot/share/scripts/gcode2gcb.py.
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define BINARY_GCODE
+
 /**
  * Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
  */
@@ -4236,6 +4334,20 @@
   #define GCODE_MACROS_SLOT_SIZE  50  // Maximum length of a single macro
 #endif
 
+/**
+ * G-code Macro Cache
+ *
+ * Parse the fixed G-code scripts run by other commands (e.g., G29_SUCCESS_COMMANDS,
+ * purge patterns, homing before a move) and M810-M819 macros once, on first use.
+ * After that they're replayed from pre-parsed commands, skipping the text parser.
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define GCODE_MACRO_CACHE
+#if ENABLED(GCODE_MACRO_CACHE)
+  #define GCODE_MACRO_CACHE_SIZE    1024  // (bytes) Storage for pre-parsed commands
+  #define GCODE_MACRO_CACHE_SCRIPTS   16  // Maximum number of cached scripts
+#endif
+
 /**
  * User-defined menu items to run custom G-code.
  * Up to 25 may be defined, but the actual number is LCD-dependent.
@@ -4834,6 +4946,66 @@
 // Enable Tests that will run at startup and produce a report
 //#define MARLIN_TEST_BUILD
 
+/**
+ * Planner Benchmark for the native simulator (simulator_linux_benchmark)
+ * Stream a recorded G-code file through the command queue and planner with the
+ * Stepper ISR stubbed out. Blocks are consumed at their planned duration and a
+ * report of blocks/second, per-call timing histograms of the planner passes and
+ * planner buffer underruns is printed when the file is done.
+ * Start the file with G92 since homing can't work without stepping.
+ */
+//#define PLANNER_BENCHMARK
+#if ENABLED(PLANNER_BENCHMARK)
+  #define PLANNER_BENCHMARK_FILE       "benchmark.gcode" // Path on the host, relative to the working directory
+  #define PLANNER_BENCHMARK_TIME_SCALE 1.0  // Consume blocks this many times faster than planned to find the underrun limit
+#endif
+
+/**
+ * Stepper ISR Profiler
+ * Measure the time spent in the Stepper ISR and each of its phases (pulse, block, Linear Advance,
+ * input shaping, FT Motion) and report min / avg / max and a histogram with M159.
+ * Uses the DWT cycle counter on ARM Cortex-M3 and up, the stepper timer elsewhere (e.g., AVR)
+ * and clock_gettime on the native simulator. Adds some overhead to every Stepper ISR.
+ *
+ *  M159   - Report ISR timing
+ *  M159 R - Reset the statistics
+ *  M159 S<seconds> - Set the auto-report interval
+ */
+//#define STEPPER_ISR_PROFILER
+
+/**
+ * Idle Task Scheduler
+ * Give the idle() tasks priorities and a time budget for each pass. Background tasks (display,
+ * status reports, media checks) wait while the planner is running low, so a slow display redraw
+ * can't keep new moves from reaching the planner. M160 reports the time spent in each task.
+ *
+ *  M160   - Report idle task timing
+ *  M160 R - Reset the statistics
+ */
+//#define IDLE_TASK_SCHEDULER
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #define IDLE_TASK_BUDGET_US 2000  // (µs) Time for each pass through idle() before tasks have to wait
+  #define IDLE_TASK_LOW_WATER    4  // Background tasks wait while fewer moves than this are in the planner
+  #define IDLE_TASK_MAX_DEFER  250  // (ms) Longest time a task can be held back
+#endif
+
+/**
+ * Latency Trace
+ * Log the start and end of each idle() task, queue pass and command in a ring buffer, to find
+ * out what held up the main loop before a stall or planner underrun. 8 bytes of RAM per entry.
+ *
+ *  M161        - Dump the trace as CSV: time (µs), '+' start or '-' end, task, command
+ *  M161 B      - Dump the trace in binary
+ *  M161 F      - Write the trace to LATENCY_TRACE_FILE (Native simulator only)
+ *  M161 R      - Clear the trace
+ *  M161 S<0|1> - Stop / Resume tracing
+ */
+//#define LATENCY_TRACE
+#if ENABLED(LATENCY_TRACE)
+  #define LATENCY_TRACE_SIZE 256                // Entries in the ring buffer
+  //#define LATENCY_TRACE_FILE "latency_trace.csv"
+#endif
+
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
 
@@ -129,6 +129,32 @@ FORCE_INLINE typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::at
   return rx_buffer.tail;
 }
 
+// Send XON once the main thread has emptied the RX buffer enough
+template<typename Cfg>
+FORCE_INLINE void MarlinSerial<Cfg>::rx_tail_advanced(const ring_buffer_pos_t h, const ring_buffer_pos_t t) {
+  if (Cfg::XONOFF) {
+    // If the XOFF char was sent, or about to be sent...
+    if ((xon_xoff_state & XON_XOFF_CHAR_MASK) == XOFF_CHAR) {
+      // Get count of bytes in the RX buffer
+      const ring_buffer_pos_t rx_count = (ring_buffer_pos_t)(h - t) & (ring_buffer_pos_t)(Cfg::RX_SIZE - 1);
+      if (rx_count < (Cfg::RX_SIZE) / 10) {
+        if (Cfg::TX_SIZE > 0) {
+          // Signal we want an XON character to be sent.
+          xon_xoff_state = XON_CHAR;
+          // Enable TX ISR. Non atomic, but it will eventually enable them
+          B_UDRIE = 1;
+        }
+        else {
+          // If not using TX interrupts, we must send the XON char now
+          xon_xoff_state = XON_CHAR | XON_XOFF_CHAR_SENT;
+          while (!B_UDRE) sw_barrier();
+          R_UDR = XON_CHAR;
+        }
+      }
+    }
+  }
+}
+
 // (called with RX interrupts disabled)
 template<typename Cfg>
 FORCE_INLINE void MarlinSerial<Cfg>::store_rxd_char() {
@@ -394,31 +420,36 @@ int MarlinSerial<Cfg>::read() {
   // if it interrupts the writing of the value of that variable in the middle.
   atomic_set_rx_tail(t);
 
-  if (Cfg::XONOFF) {
-    // If the XOFF char was sent, or about to be sent...
-    if ((xon_xoff_state & XON_XOFF_CHAR_MASK) == XOFF_CHAR) {
-      // Get count of bytes in the RX buffer
-      const ring_buffer_pos_t rx_count = (ring_buffer_pos_t)(h - t) & (ring_buffer_pos_t)(Cfg::RX_SIZE - 1);
-      if (rx_count < (Cfg::RX_SIZE) / 10) {
-        if (Cfg::TX_SIZE > 0) {
-          // Signal we want an XON character to be sent.
-          xon_xoff_state = XON_CHAR;
-          // Enable TX ISR. Non atomic, but it will eventually enable them
-          B_UDRIE = 1;
-        }
-        else {
-          // If not using TX interrupts, we must send the XON char now
-          xon_xoff_state = XON_CHAR | XON_XOFF_CHAR_SENT;
-          while (!B_UDRE) sw_barrier();
-          R_UDR = XON_CHAR;
-        }
-      }
-    }
-  }
+  rx_tail_advanced(h, t);
 
   return v;
 }
 
+// Copy the received bytes up to and including the first end-of-line, at most 'len'
+// of them, and advance the tail once
+template<typename Cfg>
+int MarlinSerial<Cfg>::readLine(char * const buf, const int len) {
+  const ring_buffer_pos_t h = atomic_read_rx_head();
+
+  // Read the tail. Main thread owns it, so it is safe to directly read it
+  ring_buffer_pos_t t = rx_buffer.tail;
+
+  int n = 0;
+  while (t != h && n < len) {
+    const char c = rx_buffer.buffer[t];
+    t = (ring_buffer_pos_t)(t + 1) & (Cfg::RX_SIZE - 1);
+    buf[n++] = c;
+    if (ISEOL(c)) break;
+  }
+
+  if (n) {
+    atomic_set_rx_tail(t);
+    rx_tail_advanced(h, t);
+  }
+
+  return n;
+}
+
 template<typename Cfg>
 typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::available() {
   const ring_buffer_pos_t h = atomic_read_rx_head(), t = rx_buffer.tail;
@@ -192,6 +192,8 @@
     FORCE_INLINE static void atomic_set_rx_tail(ring_buffer_pos_t value);
     FORCE_INLINE static ring_buffer_pos_t atomic_read_rx_tail();
 
+    FORCE_INLINE static void rx_tail_advanced(const ring_buffer_pos_t h, const ring_buffer_pos_t t);
+
   public:
     FORCE_INLINE static void store_rxd_char();
     FORCE_INLINE static void _tx_udr_empty_irq();
@@ -201,6 +203,7 @@
     static void end();
     static int peek();
     static int read();
+    static int readLine(char * const buf, const int len);
     static void flush();
     static ring_buffer_pos_t available();
     static void write(const uint8_t c);
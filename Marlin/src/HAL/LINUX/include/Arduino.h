@@ -77,6 +77,7 @@ extern "C" void delay(const int ms);
 void _delay_ms(const int ms);
 void delayMicroseconds(unsigned long);
 uint32_t millis();
+uint32_t micros();
 
 //IO functions
 void pinMode(const pin_t, const uint8_t);
@@ -131,6 +131,8 @@ extern DefaultSerial1 USBSerial;
 
 #define HAL_ADC_RESOLUTION     12   // 15 bit maximum, raw temperature is stored as int16_t
 #define HAL_ADC_FILTERED            // Disable oversampling done in Marlin as ADC values already filtered in HAL
+#define HAL_ADC_CONTINUOUS          // The ADC converts all channels in burst mode
+#define HAL_ADC_OVERSAMPLE      1   // The filtered value stands for one sample
 
 //
 // Pin Mapping for M42, M43, M226
@@ -256,6 +258,13 @@ public:
     return uint16_t(adc_result);
   }
 
+  #if ENABLED(CONTINUOUS_ADC_SAMPLING)
+    // The filtered value of a pin from the burst mode conversions
+    static uint32_t adc_oversampled(const pin_t pin) {
+      return FilteredADC::read(pin) >> (16 - HAL_ADC_RESOLUTION);
+    }
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
@@ -730,11 +730,20 @@ void MarlinHAL::adc_init() {
       // Preloaded data (fixed for all ADC instances hence not loaded by DMA)
       adc->REFCTRL.bit.REFSEL = ADC_REFCTRL_REFSEL_AREFA_Val;               // VRefA pin
       SYNC(adc->SYNCBUSY.bit.REFCTRL);
-      adc->CTRLB.bit.RESSEL = ADC_CTRLB_RESSEL_10BIT_Val;                   // ... ADC_CTRLB_RESSEL_16BIT_Val
-      SYNC(adc->SYNCBUSY.bit.CTRLB);
-      adc->SAMPCTRL.bit.SAMPLEN = (6 - 1);                                  // Sampling clocks
-      //adc->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_16 | ADC_AVGCTRL_ADJRES(4);  // 16 Accumulated conversions and shift 4 to get oversampled 12 bits result
-      //SYNC(adc->SYNCBUSY.bit.AVGCTRL);
+      #if ENABLED(CONTINUOUS_ADC_SAMPLING)
+        adc->CTRLB.bit.RESSEL = ADC_CTRLB_RESSEL_16BIT_Val;                 // Accumulated result
+        SYNC(adc->SYNCBUSY.bit.CTRLB);
+        adc->SAMPCTRL.bit.SAMPLEN = (6 - 1);                                // Sampling clocks
+        adc->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_16                         // 16 Accumulated 12 bits conversions, shifted to
+                         | ADC_AVGCTRL_ADJRES(12 - HAL_ADC_RESOLUTION);     // the sum of 16 HAL_ADC_RESOLUTION bits results
+        SYNC(adc->SYNCBUSY.bit.AVGCTRL);
+      #else
+        adc->CTRLB.bit.RESSEL = ADC_CTRLB_RESSEL_10BIT_Val;                 // ... ADC_CTRLB_RESSEL_16BIT_Val
+        SYNC(adc->SYNCBUSY.bit.CTRLB);
+        adc->SAMPCTRL.bit.SAMPLEN = (6 - 1);                                // Sampling clocks
+        //adc->AVGCTRL.reg = ADC_AVGCTRL_SAMPLENUM_16 | ADC_AVGCTRL_ADJRES(4);  // 16 Accumulated conversions and shift 4 to get oversampled 12 bits result
+        //SYNC(adc->SYNCBUSY.bit.AVGCTRL);
+      #endif
 
       // Registers loaded by DMA
       adc->DSEQCTRL.bit.INPUTCTRL = true;
@@ -749,10 +758,26 @@ void MarlinHAL::adc_init() {
 void MarlinHAL::adc_start(const pin_t pin) {
   #if ADC_IS_REQUIRED
     for (uint8_t pi = 0; pi < COUNT(adc_pins); ++pi)
-      if (pin == adc_pins[pi]) { adc_result = adc_results[pi]; return; }
+      if (pin == adc_pins[pi]) {
+        // An accumulated result is the sum of 16 conversions
+        adc_result = adc_results[pi] >> TERN0(CONTINUOUS_ADC_SAMPLING, 4);
+        return;
+      }
   #endif
 
   adc_result = 0xFFFF;
 }
 
+#if ENABLED(CONTINUOUS_ADC_SAMPLING)
+
+  uint32_t MarlinHAL::adc_oversampled(const pin_t pin) {
+    #if ADC_IS_REQUIRED
+      for (uint8_t pi = 0; pi < COUNT(adc_pins); ++pi)
+        if (pin == adc_pins[pi]) return adc_results[pi];
+    #endif
+    return 0;
+  }
+
+#endif
+
 #endif // __SAMD51__
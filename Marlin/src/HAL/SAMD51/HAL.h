@@ -114,6 +114,8 @@ typedef Servo hal_servo_t;
 //#define HAL_ADC_FILTERED          // Disable Marlin's oversampling. The HAL filters ADC values.
 #define HAL_ADC_VREF_MV   3300
 #define HAL_ADC_RESOLUTION  10      // ... 12
+#define HAL_ADC_CONTINUOUS          // The ADC scans all pins by DMA
+#define HAL_ADC_OVERSAMPLE  16      // Conversions accumulated by the ADC for CONTINUOUS_ADC_SAMPLING
 
 //
 // Pin Mapping for M42, M43, M226
@@ -207,6 +209,11 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  #if ENABLED(CONTINUOUS_ADC_SAMPLING)
+    // Sum of the last HAL_ADC_OVERSAMPLE conversions of a pin
+    static uint32_t adc_oversampled(const pin_t pin);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * No option to invert the duty cycle [default = false]
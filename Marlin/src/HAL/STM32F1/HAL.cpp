@@ -30,7 +30,7 @@
 #include "HAL.h"
 
 #include "adc.h"
-uint16_t adc_results[ADC_COUNT];
+uint16_t adc_results[ADC_SCANS * ADC_COUNT];
 
 // ------------------------
 // Serial ports
@@ -160,7 +160,7 @@ void MarlinHAL::adc_init() {
   adc.calibrate();
   adc.setSampleRate((F_CPU > 72000000) ? ADC_SMPR_71_5 : ADC_SMPR_41_5); // 71.5 or 41.5 ADC cycles
   adc.setPins((uint8_t *)adc_pins, ADC_COUNT);
-  adc.setDMA(adc_results, uint16_t(ADC_COUNT), uint32_t(DMA_MINC_MODE | DMA_CIRC_MODE), nullptr);
+  adc.setDMA(adc_results, uint16_t(ADC_SCANS * ADC_COUNT), uint32_t(DMA_MINC_MODE | DMA_CIRC_MODE), nullptr);
   adc.setScanMode();
   adc.setContinuous();
   adc.startConversion();
@@ -168,12 +168,12 @@ void MarlinHAL::adc_init() {
 
 #endif // !VOXELAB_N32
 
-void MarlinHAL::adc_start(const pin_t pin) {
-  #define __TCASE(N,I) case N: pin_index = I; break;
+// Index of a pin in the ADC scan, or ADC_COUNT if it isn't scanned
+static ADCIndex adc_index(const pin_t pin) {
+  #define __TCASE(N,I) case N: return I;
   #define _TCASE(C,N,I) TERN_(C, __TCASE(N, I))
-  ADCIndex pin_index;
   switch (pin) {
-    default: return;
+    default: return ADC_COUNT;
     _TCASE(HAS_TEMP_ADC_0,        TEMP_0_PIN,                TEMP_0)
     _TCASE(HAS_TEMP_ADC_1,        TEMP_1_PIN,                TEMP_1)
     _TCASE(HAS_TEMP_ADC_2,        TEMP_2_PIN,                TEMP_2)
@@ -196,9 +196,26 @@ void MarlinHAL::adc_start(const pin_t pin) {
     _TCASE(POWER_MONITOR_CURRENT, POWER_MONITOR_CURRENT_PIN, POWERMON_CURRENT)
     _TCASE(POWER_MONITOR_VOLTAGE, POWER_MONITOR_VOLTAGE_PIN, POWERMON_VOLTAGE)
   }
+}
+
+void MarlinHAL::adc_start(const pin_t pin) {
+  const ADCIndex pin_index = adc_index(pin);
+  if (pin_index == ADC_COUNT) return;
   adc_result = (adc_results[(int)pin_index] & 0xFFF) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
 }
 
+#if ENABLED(CONTINUOUS_ADC_SAMPLING)
+
+  uint32_t MarlinHAL::adc_oversampled(const pin_t pin) {
+    const ADCIndex pin_index = adc_index(pin);
+    if (pin_index == ADC_COUNT) return 0;
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < ADC_SCANS; ++i) sum += adc_results[i * ADC_COUNT + pin_index] & 0xFFF;
+    return sum >> (12 - HAL_ADC_RESOLUTION);
+  }
+
+#endif
+
 // ------------------------
 // Public functions
 // ------------------------
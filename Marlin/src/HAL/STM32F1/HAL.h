@@ -191,6 +191,11 @@ typedef int8_t pin_t;
 
 #define HAL_ADC_VREF_MV   3300
 
+#ifndef VOXELAB_N32
+  #define HAL_ADC_CONTINUOUS        // The ADC scans all pins by DMA
+  #define HAL_ADC_OVERSAMPLE 16     // Scans kept by DMA for CONTINUOUS_ADC_SAMPLING
+#endif
+
 uint16_t analogRead(const pin_t pin); // need hal.adc_enable() first
 void analogWrite(const pin_t pin, int pwm_val8); // PWM only! mul by 257 in maple!?
 
@@ -293,6 +298,11 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  #if ENABLED(CONTINUOUS_ADC_SAMPLING)
+    // Sum of the last HAL_ADC_OVERSAMPLE conversions of a pin
+    static uint32_t adc_oversampled(const pin_t pin);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
@@ -54,4 +54,10 @@ enum ADCIndex : uint8_t {
   ADC_COUNT
 };
 
-extern uint16_t adc_results[ADC_COUNT];
+#if ENABLED(CONTINUOUS_ADC_SAMPLING)
+  #define ADC_SCANS HAL_ADC_OVERSAMPLE  // Full scans in the DMA ring buffer
+#else
+  #define ADC_SCANS 1
+#endif
+
+extern uint16_t adc_results[ADC_SCANS * ADC_COUNT];
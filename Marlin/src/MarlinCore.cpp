@@ -54,6 +54,9 @@
 #if ENABLED(FT_MOTION)
   #include "module/ft_motion.h"
 #endif
+#if ENABLED(STEP_COMPRESSION)
+  #include "module/step_compress.h"
+#endif
 
 #include "gcode/gcode.h"
 #include "gcode/parser.h"
@@ -262,6 +265,26 @@
   #include "tests/marlin_tests.h"
 #endif
 
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "feature/planner_benchmark.h"
+#endif
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+  #include "feature/isr_profiler.h"
+#endif
+
+#if ENABLED(LATENCY_TRACE)
+  #include "feature/latency_trace.h"
+#else
+  #define TRACE_SPAN(T, F) do{ F; }while(0)
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #include "feature/idle_scheduler.h"
+#else
+  #define IDLE_TASK(T, F) TRACE_SPAN(T, F)
+#endif
+
 PGMSTR(M112_KILL_STR, "M112 Shutdown");
 
 MarlinState marlin_state = MF_INITIALIZING;
@@ -416,7 +439,9 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
   if (gcode.stepper_max_timed_out(ms)) {
     SERIAL_ERROR_START();
     SERIAL_ECHOPGM(STR_KILL_PRE);
-    SERIAL_ECHOLNPGM(STR_KILL_INACTIVE_TIME, parser.command_ptr);
+    SERIAL_ECHOPGM(STR_KILL_INACTIVE_TIME);
+    parser.echo_command(parser.command_ptr);
+    SERIAL_EOL();
     kill();
   }
 
@@ -705,7 +730,7 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
 
   TERN_(TEMP_STAT_LEDS, handle_status_leds());
 
-  TERN_(MONITOR_DRIVER_STATUS, monitor_tmc_drivers());
+  TERN_(MONITOR_DRIVER_STATUS, IDLE_TASK(TMC_MONITOR, monitor_tmc_drivers()));
 
   // Limit check_axes_activity frequency to 10Hz
   static millis_t next_check_axes_ms = 0;
@@ -729,6 +754,18 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
   #include "feature/babystep.h"
 #endif
 
+#if HAS_AUTO_REPORTING
+  // Auto-report Temperatures / SD Status
+  static void auto_report_tick() {
+    TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+    TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+    TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+    TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+    TERN_(STEPPER_ISR_PROFILER, isr_profiler.auto_reporter.tick());
+    TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+  }
+#endif
+
 /**
  * Standard idle routine keeps the machine alive:
  *  - Core Marlin activities
@@ -761,6 +798,12 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
   #endif
 
+  // Trace the whole pass, including nested calls
+  TERN_(LATENCY_TRACE, const LatencyTrace::Span trace_span(LatencyTrace::IDLE));
+
+  // Start the time budget for this pass
+  TERN_(IDLE_TASK_SCHEDULER, idle_scheduler.start_pass());
+
   // Bed Distance Sensor task
   TERN_(BD_SENSOR, bdl.process());
 
@@ -768,10 +811,10 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   manage_inactivity(no_stepper_sleep);
 
   // Manage Heaters (and Watchdog)
-  thermalManager.task();
+  IDLE_TASK(HEATERS, thermalManager.task());
 
   // Max7219 heartbeat, animation, etc
-  TERN_(MAX7219_DEBUG, max7219.idle_tasks());
+  TERN_(MAX7219_DEBUG, IDLE_TASK(MAX7219, max7219.idle_tasks()));
 
   // Return if setup() isn't completed
   if (marlin_state == MF_INITIALIZING) goto IDLE_DONE;
@@ -782,18 +825,18 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle filament runout sensors
   #if HAS_FILAMENT_SENSOR
     if (TERN1(HAS_PRUSA_MMU2, !mmu2.enabled()))
-      runout.run();
+      IDLE_TASK(RUNOUT, runout.run());
   #endif
 
   // Run HAL idle tasks
   hal.idletask();
 
   // Check network connection
-  TERN_(HAS_ETHERNET, ethernet.check());
+  TERN_(HAS_ETHERNET, IDLE_TASK(ETHERNET, ethernet.check()));
 
   // Handle Power-Loss Recovery
   #if ENABLED(POWER_LOSS_RECOVERY) && PIN_EXISTS(POWER_LOSS)
-    if (IS_SD_PRINTING()) recovery.outage();
+    if (IS_SD_PRINTING()) IDLE_TASK(RECOVERY, recovery.outage());
   #endif
 
   // Run StallGuard endstop checks
@@ -803,7 +846,10 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #endif
 
   // Handle SD Card insert / remove
-  TERN_(HAS_MEDIA, card.manage_media());
+  TERN_(HAS_MEDIA, IDLE_TASK(MEDIA, card.manage_media()));
+
+  // Read the print file ahead
+  TERN_(SD_READ_AHEAD, card.read_ahead());
 
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
@@ -818,7 +864,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   TERN_(HAS_BEEPER, buzzer.tick());
 
   // Handle UI input / draw events
-  ui.update();
+  IDLE_TASK(UI, ui.update());
 
   // Run i2c Position Encoders
   #if ENABLED(I2C_POSITION_ENCODERS)
@@ -827,7 +873,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (planner.has_blocks_queued()) {
       const millis_t ms = millis();
       if (ELAPSED(ms, i2cpem_next_update_ms)) {
-        I2CPEM.update();
+        IDLE_TASK(ENCODERS, I2CPEM.update());
         i2cpem_next_update_ms = ms + I2CPE_MIN_UPD_TIME_MS;
       }
     }
@@ -836,17 +882,11 @@ void idle(const bool no_stepper_sleep/*=false*/) {
 
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
-    if (!gcode.autoreport_paused) {
-      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
-      TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
-      TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
-      TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
-      TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
-    }
+    if (!gcode.autoreport_paused) IDLE_TASK(REPORTS, auto_report_tick());
   #endif
 
   // Update the Průša MMU2
-  TERN_(HAS_PRUSA_MMU2, mmu2.mmu_loop());
+  TERN_(HAS_PRUSA_MMU2, IDLE_TASK(MMU, mmu2.mmu_loop()));
 
   // Handle Joystick jogging
   TERN_(POLL_JOG, joystick.inject_jog_moves());
@@ -860,11 +900,20 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   TERN_(DIRECT_STEPPING, page_manager.write_responses());
 
   // Update the LVGL interface
-  TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
+  TERN_(HAS_TFT_LVGL_UI, IDLE_TASK(LVGL, LV_TASK_HANDLER()));
+
+  // Subdivide the next row of the bilinear mesh
+  TERN_(COMPACT_SUBDIVIDED_MESH, IDLE_TASK(MESH, bedlevel.subdivide_task()));
 
   // Manage Fixed-time Motion Control
   TERN_(FT_MOTION, ftMotion.loop());
 
+  // Compress planner blocks into step sequences
+  TERN_(STEP_COMPRESSION, stepCompressor.loop());
+
+  // Feed the Planner Benchmark and consume its blocks
+  TERN_(PLANNER_BENCHMARK, planner_benchmark.task());
+
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
 
@@ -1358,6 +1407,10 @@ void setup() {
     SETUP_RUN(refresh_delta_clip_start_height()); // Init safe delta height without soft endstops
   #endif
 
+  #if ENABLED(STEPPER_ISR_PROFILER)
+    SETUP_RUN(isr_profiler.init());   // Before the Stepper ISR starts
+  #endif
+
   SETUP_RUN(stepper.init());          // Init stepper. This enables interrupts!
 
   #if HAS_SERVOS
@@ -1679,7 +1732,7 @@ void loop() {
       if (marlin_state == MF_SD_COMPLETE) finishSDPrinting();
     #endif
 
-    queue.advance();
+    TRACE_SPAN(QUEUE, queue.advance());
 
     #if ANY(POWER_OFF_TIMER, POWER_OFF_WAIT_FOR_COOLDOWN)
       powerManager.checkAutoPowerOff();
@@ -71,6 +71,7 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+CALL_IF_EXISTS_IMPL(int, readLine, 0);
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
@@ -121,6 +122,20 @@ struct SerialBase {
       @param index  The port index, usually 0 */
   int read(serial_index_t index=0)        { return SerialChild->read(index); }
 
+  /** Read received bytes up to and including the first end-of-line, at most 'len' bytes.
+      This reads one byte at a time. Ports with a receive buffer copy the line at once.
+      @param index  The port index, usually 0 */
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    int n = 0;
+    while (n < len) {
+      const int c = SerialChild->read(index);
+      if (c < 0) break;
+      buf[n++] = c;
+      if (ISEOL(c)) break;
+    }
+    return n;
+  }
+
   /** Combine the features of this serial instance and return it
       @param index  The port index, usually 0 */
   SerialFeature features(serial_index_t index=0) const { return static_cast<const Child*>(this)->features(index);  }
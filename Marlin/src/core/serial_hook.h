@@ -64,6 +64,11 @@ struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
   // We don't care about indices here, since if one can call us, it's the right index anyway
   int available(serial_index_t) { return (int)SerialT::available(); }
   int read(serial_index_t)      { return (int)SerialT::read(); }
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    return Private::HasMember_readLine<SerialT>::value
+      ? CALL_IF_EXISTS(int, static_cast<SerialT*>(this), readLine, buf, len)
+      : BaseClassT::readLine(index, buf, len);
+  }
   bool connected()              { return CALL_IF_EXISTS(bool, static_cast<SerialT*>(this), connected);; }
   void flushTX()                { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
 
@@ -106,6 +111,11 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   int read(serial_index_t)        { return (int)out.read(); }
   int available()                 { return (int)out.available(); }
   int read()                      { return (int)out.read(); }
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    return Private::HasMember_readLine<SerialT>::value
+      ? CALL_IF_EXISTS(int, &out, readLine, buf, len)
+      : BaseClassT::readLine(index, buf, len);
+  }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ConditionalSerial(bool & conditionVariable, SerialT & out, const bool e) : BaseClassT(e), condition(conditionVariable), out(out) {}
@@ -131,6 +141,11 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   int read(serial_index_t)      { return (int)out.read(); }
   int available()               { return (int)out.available(); }
   int read()                    { return (int)out.read(); }
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    return Private::HasMember_readLine<SerialT>::value
+      ? CALL_IF_EXISTS(int, &out, readLine, buf, len)
+      : BaseClassT::readLine(index, buf, len);
+  }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ForwardSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
@@ -158,6 +173,11 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
 
   int available(serial_index_t)  { return (int)SerialT::available(); }
   int read(serial_index_t)       { return (int)SerialT::read(); }
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    return Private::HasMember_readLine<SerialT>::value
+      ? CALL_IF_EXISTS(int, static_cast<SerialT*>(this), readLine, buf, len)
+      : BaseClassT::readLine(index, buf, len);
+  }
   using SerialT::available;
   using SerialT::read;
   using SerialT::flush;
@@ -247,6 +267,13 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     #undef _S_READ
     return -1;
   }
+  int readLine(serial_index_t index, char * const buf, const int len) {
+    uint8_t pos = offset;
+    #define _S_READLINE(N) if (index.within(pos, pos + step - 1)) return serial##N.readLine(index, buf, len); else pos += step;
+    REPEAT(NUM_SERIAL, _S_READLINE);
+    #undef _S_READLINE
+    return 0;
+  }
   void begin(const long br) {
     #define _S_BEGIN(N) if (portMask.enabled(output[N])) serial##N.begin(br);
     REPEAT(NUM_SERIAL, _S_BEGIN);
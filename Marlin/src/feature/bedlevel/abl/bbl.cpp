@@ -27,6 +27,7 @@
 #include "../bedlevel.h"
 
 #include "../../../module/motion.h"
+#include "../../../module/planner.h"
 
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
@@ -161,7 +162,12 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
       SERIAL_ECHOLNPGM("Subdivided with CATMULL ROM Leveling Grid:");
-      print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+        finish_subdivision();
+        print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, virt_z);
+      #else
+        print_2d_array(ABL_GRID_POINTS_VIRT_X, ABL_GRID_POINTS_VIRT_Y, 5, z_values_virt[0]);
+      #endif
     }
   #endif
 }
@@ -170,7 +176,12 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
   #define ABL_TEMP_POINTS_X (GRID_MAX_POINTS_X + 2)
   #define ABL_TEMP_POINTS_Y (GRID_MAX_POINTS_Y + 2)
-  float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+    int16_t LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    uint8_t LevelingBilinear::virt_rows; // = 0
+  #else
+    float LevelingBilinear::z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+  #endif
   xy_pos_t LevelingBilinear::grid_spacing_virt;
   xy_float_t LevelingBilinear::grid_factor_virt;
 
@@ -229,41 +240,81 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
     ) * 0.5f;
   }
 
-  float LevelingBilinear::virt_2cmr(const uint8_t x, const uint8_t y, const_float_t tx, const_float_t ty) {
-    float row[4], column[4];
-    for (uint8_t i = 0; i < 4; ++i) {
-      for (uint8_t j = 0; j < 4; ++j) {
-        column[j] = virt_coord(i + x - 1, j + y - 1);
-      }
+  /**
+   * Subdivide one row of the virtual grid. Every column of the extended
+   * grid is interpolated to the row once, then the points of the row are
+   * interpolated from the columns.
+   */
+  void LevelingBilinear::subdivide_row(const uint8_t vy) {
+    const uint8_t y = vy / (BILINEAR_SUBDIVISIONS);
+    const float ty = float(vy % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS);
+    float row[ABL_TEMP_POINTS_X + 1], column[4];
+    for (uint8_t i = 0; i < ABL_TEMP_POINTS_X + 1; ++i) {
+      for (uint8_t j = 0; j < 4; ++j) column[j] = virt_coord(i, y + j);
       row[i] = virt_cmr(column, 1, ty);
     }
-    return virt_cmr(row, 1, tx);
+    for (uint8_t vx = 0; vx < ABL_GRID_POINTS_VIRT_X; ++vx) {
+      const uint8_t x = vx / (BILINEAR_SUBDIVISIONS);
+      const float z = virt_cmr(&row[x], 1, float(vx % (BILINEAR_SUBDIVISIONS)) / (BILINEAR_SUBDIVISIONS));
+      #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+        const int32_t zs = isnan(z) ? INT16_MAX : LROUND(z * 1000);
+        z_values_virt[vx][vy] = WITHIN(zs, INT16_MIN, INT16_MAX - 1) ? int16_t(zs) : INT16_MAX;
+      #else
+        z_values_virt[vx][vy] = z;
+      #endif
+    }
   }
 
   void LevelingBilinear::subdivide_mesh() {
     grid_spacing_virt = grid_spacing / (BILINEAR_SUBDIVISIONS);
     grid_factor_virt = grid_spacing_virt.reciprocal();
-    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y)
-      for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x)
-        for (uint8_t ty = 0; ty < BILINEAR_SUBDIVISIONS; ++ty)
-          for (uint8_t tx = 0; tx < BILINEAR_SUBDIVISIONS; ++tx) {
-            if ((ty && y == (GRID_MAX_POINTS_Y) - 1) || (tx && x == (GRID_MAX_POINTS_X) - 1))
-              continue;
-            z_values_virt[x * (BILINEAR_SUBDIVISIONS) + tx][y * (BILINEAR_SUBDIVISIONS) + ty] =
-              virt_2cmr(x + 1, y + 1, (float)tx / (BILINEAR_SUBDIVISIONS), (float)ty / (BILINEAR_SUBDIVISIONS));
-          }
+    #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+      virt_rows = 0;  // Rows are done by subdivide_task()
+    #else
+      for (uint8_t vy = 0; vy < ABL_GRID_POINTS_VIRT_Y; ++vy) subdivide_row(vy);
+    #endif
   }
 
+  #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+
+    // INT16_MAX marks a point that can't be stored
+    float LevelingBilinear::virt_z(const uint8_t x, const uint8_t y) {
+      const int16_t z = z_values_virt[x][y];
+      return z == INT16_MAX ? NAN : z * 0.001f;
+    }
+
+    // Subdivide the next row. Called from idle() while leveling is off.
+    void LevelingBilinear::subdivide_task() {
+      if (virt_done()) return;
+      subdivide_row(virt_rows);
+      if (++virt_rows == ABL_GRID_POINTS_VIRT_Y) {
+        // Switch from the probed grid to the subdivided grid
+        cached_rel.x = cached_rel.y = -999.999;
+        cached_g.x = cached_g.y = -99;
+      }
+    }
+
+  #endif
+
 #endif // ABL_BILINEAR_SUBDIVISION
 
 // Refresh after other values have been updated
 void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  // Corrections in use can't switch grids mid-motion, so finish now
+  TERN_(COMPACT_SUBDIVIDED_MESH, if (planner.leveling_active) finish_subdivision());
   cached_rel.x = cached_rel.y = -999.999;
   cached_g.x = cached_g.y = -99;
 }
 
-#if ENABLED(ABL_BILINEAR_SUBDIVISION)
+#if ENABLED(COMPACT_SUBDIVIDED_MESH)
+  // Use the probed grid until the subdivided grid is done. Only while leveling is off.
+  #define ABL_BG_SPACING(A) (virt_done() ? grid_spacing_virt.A : grid_spacing.A)
+  #define ABL_BG_FACTOR(A)  (virt_done() ? grid_factor_virt.A : grid_factor.A)
+  #define ABL_BG_POINTS_X   (virt_done() ? ABL_GRID_POINTS_VIRT_X : GRID_MAX_POINTS_X)
+  #define ABL_BG_POINTS_Y   (virt_done() ? ABL_GRID_POINTS_VIRT_Y : GRID_MAX_POINTS_Y)
+  #define ABL_BG_GRID(X,Y)  (virt_done() ? virt_z(X, Y) : z_values[X][Y])
+#elif ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
   #define ABL_BG_POINTS_X   ABL_GRID_POINTS_VIRT_X
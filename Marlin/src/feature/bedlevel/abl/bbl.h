@@ -39,13 +39,20 @@ private:
     #define ABL_GRID_POINTS_VIRT_X (GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) + 1)
     #define ABL_GRID_POINTS_VIRT_Y (GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) + 1)
 
-    static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+      static int16_t z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y]; // Z in microns
+      static uint8_t virt_rows;                                                    // Rows subdivided so far
+      static bool virt_done() { return virt_rows >= ABL_GRID_POINTS_VIRT_Y; }
+      static float virt_z(const uint8_t x, const uint8_t y);
+    #else
+      static float z_values_virt[ABL_GRID_POINTS_VIRT_X][ABL_GRID_POINTS_VIRT_Y];
+    #endif
     static xy_pos_t grid_spacing_virt;
     static xy_float_t grid_factor_virt;
 
     static float virt_coord(const uint8_t x, const uint8_t y);
     static float virt_cmr(const float p[4], const uint8_t i, const float t);
-    static float virt_2cmr(const uint8_t x, const uint8_t y, const_float_t tx, const_float_t ty);
+    static void subdivide_row(const uint8_t vy);
     static void subdivide_mesh();
   #endif
 
@@ -55,6 +62,10 @@ public:
   static void extrapolate_unprobed_bed_level();
   static void print_leveling_grid(const bed_mesh_t *_z_values=nullptr);
   static void refresh_bed_level();
+  #if ENABLED(COMPACT_SUBDIVIDED_MESH)
+    static void subdivide_task();
+    static void finish_subdivision() { while (!virt_done()) subdivide_task(); }
+  #endif
   static bool has_mesh() { return !!grid_spacing.x; }
   static bool mesh_is_valid() { return has_mesh(); }
   static float get_mesh_x(const uint8_t i) { return grid_start.x + i * grid_spacing.x; }
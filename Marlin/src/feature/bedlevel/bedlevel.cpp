@@ -75,6 +75,9 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     _report_leveling();
     planner.synchronize();
 
+    // Use the complete subdivided grid from the start
+    TERN_(COMPACT_SUBDIVIDED_MESH, if (enable) bedlevel.finish_subdivision());
+
     // Get the corrected leveled / unleveled position
     planner.apply_modifiers(current_position, true);    // Physical position with all modifiers
     planner.leveling_active ^= true;                    // Toggle leveling between apply and unapply
@@ -135,7 +138,7 @@ void reset_bed_level() {
   /**
    * Print calibration results for plotting or manual frame adjustment.
    */
-  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+  static void _print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values, element_2d_fn fn) {
     #ifndef SCAD_MESH_OUTPUT
       for (uint8_t x = 0; x < sx; ++x) {
         SERIAL_ECHO_SP(precision + (x < 10 ? 3 : 2));
@@ -155,7 +158,7 @@ void reset_bed_level() {
       #endif
       for (uint8_t x = 0; x < sx; ++x) {
         SERIAL_CHAR(' ');
-        const float offset = values[x * sy + y];
+        const float offset = fn ? fn(x, y) : values[x * sy + y];
         if (!isnan(offset)) {
           if (offset >= 0) SERIAL_CHAR('+');
           SERIAL_ECHO(p_float_t(offset, precision));
@@ -186,6 +189,14 @@ void reset_bed_level() {
     SERIAL_EOL();
   }
 
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values) {
+    _print_2d_array(sx, sy, precision, values, nullptr);
+  }
+
+  void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn fn) {
+    _print_2d_array(sx, sy, precision, nullptr, fn);
+  }
+
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
 #if ANY(MESH_BED_LEVELING, PROBE_MANUALLY)
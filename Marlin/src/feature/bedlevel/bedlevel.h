@@ -79,6 +79,7 @@ class TemporaryBedLevelingState {
      * Print calibration results for plotting or manual frame adjustment.
      */
     void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, const float *values);
+    void print_2d_array(const uint8_t sx, const uint8_t sy, const uint8_t precision, element_2d_fn fn);
 
   #endif
 
@@ -0,0 +1,138 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(LEVELING_CORRECTION_STREAM)
+
+#include "leveling_stream.h"
+#include "bedlevel.h"
+#include "../../module/planner.h"
+
+LevelingStream levelingStream;
+
+xy_pos_t LevelingStream::origin, LevelingStream::step;
+float LevelingStream::limit;
+uint16_t LevelingStream::index;
+float LevelingStream::piece_start, LevelingStream::piece_end,
+      LevelingStream::z0, LevelingStream::slope, LevelingStream::curve,
+      LevelingStream::z_end;
+xy_float_t LevelingStream::cross, LevelingStream::cross_dist;
+xy_uint8_t LevelingStream::lines_left;
+
+// The grid lines where the mesh correction can bend
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+  #define GRID_ORIGIN_X   bedlevel.grid_start.x
+  #define GRID_ORIGIN_Y   bedlevel.grid_start.y
+  #define GRID_SPACING_X  (bedlevel.grid_spacing.x / TERN(ABL_BILINEAR_SUBDIVISION, (BILINEAR_SUBDIVISIONS), 1))
+  #define GRID_SPACING_Y  (bedlevel.grid_spacing.y / TERN(ABL_BILINEAR_SUBDIVISION, (BILINEAR_SUBDIVISIONS), 1))
+  #define GRID_LINES_X    TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X)
+  #define GRID_LINES_Y    TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y)
+#else
+  #define GRID_ORIGIN_X   MESH_MIN_X
+  #define GRID_ORIGIN_Y   MESH_MIN_Y
+  #define GRID_SPACING_X  MESH_X_DIST
+  #define GRID_SPACING_Y  MESH_Y_DIST
+  #define GRID_LINES_X    GRID_MAX_POINTS_X
+  #define GRID_LINES_Y    GRID_MAX_POINTS_Y
+#endif
+
+/**
+ * Find the first grid line crossed moving 'a' per segment from 'p'.
+ * Get the crossing and the distance between grid lines in segments,
+ * and the number of grid lines after the first one.
+ */
+static void first_crossing(const_float_t p, const_float_t a, const_float_t org, const_float_t spacing, const uint8_t lines, float &cross, float &dist, uint8_t &left) {
+  cross = INFINITY;
+  dist = 0;
+  left = 0;
+  if (!a) return;
+  const float rel = (p - org) / spacing;
+  int16_t i;
+  if (a > 0) {
+    i = _MAX(int16_t(FLOOR(rel)) + 1, 0);
+    if (i > lines - 1) return;
+    left = lines - 1 - i;
+  }
+  else {
+    i = _MIN(int16_t(CEIL(rel)) - 1, lines - 1);
+    if (i < 0) return;
+    left = i;
+  }
+  cross = (org + i * spacing - p) / a;
+  dist = spacing / ABS(a);
+}
+
+void LevelingStream::start(const xy_pos_t &start, const xy_pos_t &d, const uint16_t segments) {
+  origin = start;
+  step = d;
+  limit = segments;
+  index = 0;
+  piece_start = piece_end = 0;
+  z_end = bedlevel.get_z_correction(start);
+  first_crossing(start.x, d.x, GRID_ORIGIN_X, GRID_SPACING_X, GRID_LINES_X, cross.x, cross_dist.x, lines_left.x);
+  first_crossing(start.y, d.y, GRID_ORIGIN_Y, GRID_SPACING_Y, GRID_LINES_Y, cross.y, cross_dist.y, lines_left.y);
+}
+
+// Fit a quadratic to the next cell crossing from its ends and middle
+void LevelingStream::next_piece() {
+  const float sa = piece_end;
+  float sb = _MIN(cross.x, cross.y);
+  NOMORE(sb, _MAX(limit, float(index)));
+
+  for (uint8_t i = 0; i < 2; ++i) {
+    if (cross[i] > sb) continue;
+    if (lines_left[i]) { --lines_left[i]; cross[i] += cross_dist[i]; }
+    else cross[i] = INFINITY;
+  }
+
+  const float h = sb - sa, za = z_end,
+              zm = bedlevel.get_z_correction(origin + step * ((sa + sb) * 0.5f));
+  z_end = bedlevel.get_z_correction(origin + step * sb);
+
+  piece_start = sa;
+  piece_end = sb;
+  z0 = za;
+  curve = 2.0f * (za - 2.0f * zm + z_end) / sq(h);
+  slope = (z_end - za) / h - curve * h;
+}
+
+xyze_pos_t LevelingStream::leveled(const xyze_pos_t &raw) {
+  ++index;
+  xyze_pos_t pos = raw;
+  if (!planner.leveling_active) return pos;
+
+  while (index > piece_end) next_piece();
+  const float t = index - piece_start, z = z0 + t * (slope + t * curve);
+
+  #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
+    pos.z += planner.fade_scaling_factor_for_z(raw.z) * z;
+  #else
+    pos.z += z;
+  #endif
+
+  TERN_(MESH_BED_LEVELING, pos.z += bedlevel.get_z_offset());
+
+  return pos;
+}
+
+#endif // LEVELING_CORRECTION_STREAM
@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * leveling_stream.h - Leveling corrections along a segmented line
+ *
+ * Along a straight line the bilinear mesh correction is a quadratic within each
+ * mesh cell. The points where the line crosses the grid lines are found once,
+ * and the mesh is only looked up at the end and the middle of each cell crossing.
+ * The correction for every segment in between comes from the quadratic.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+class LevelingStream {
+  public:
+    // Begin a line of 'segments' segments, each moving 'step' in XY
+    static void start(const xy_pos_t &start, const xy_pos_t &step, const uint16_t segments);
+
+    // Level the next segment target, the same as Planner::apply_leveling
+    static xyze_pos_t leveled(const xyze_pos_t &raw);
+
+  private:
+    static xy_pos_t origin, step;
+    static float limit;               // Segments in the line
+    static uint16_t index;            // Segment of the last target
+    static float piece_start,         // Bounds of the current cell crossing, in segments
+                 piece_end,
+                 z0, slope, curve,    // Correction across the crossing as a quadratic
+                 z_end;               // Correction at the end of the crossing
+    static xy_float_t cross,          // Next grid line crossings, in segments
+                      cross_dist;     // Segments from one grid line to the next
+    static xy_uint8_t lines_left;     // Grid lines ahead after the next crossing
+
+    static void next_piece();
+};
+
+extern LevelingStream levelingStream;
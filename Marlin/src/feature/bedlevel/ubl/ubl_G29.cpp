@@ -765,6 +765,14 @@ void unified_bed_leveling::shift_mesh_height() {
 
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
+
+    #if ENABLED(PROBE_SWEEP)
+      xy_pos_t near_pos = nearby; // Search from the last point probed
+      if (!stow_probe) probe.sweep_start();
+    #else
+      const xy_pos_t &near_pos = nearby;
+    #endif
+
     do {
       if (do_ubl_mesh_map) display_map(param.T_map_type);
 
@@ -780,6 +788,7 @@ void unified_bed_leveling::shift_mesh_height() {
           ui.wait_for_release();
           ui.quick_feedback();
           ui.release();
+          TERN_(PROBE_SWEEP, probe.sweep_end());
           probe.stow(); // Release UI before stow to allow for PAUSE_BEFORE_DEPLOY_STOW
           return restore_ubl_active_state();
         }
@@ -791,12 +800,13 @@ void unified_bed_leveling::shift_mesh_height() {
 
       best = do_furthest // Points with valid data or HUGE_VALF are skipped
         ? find_furthest_invalid_mesh_point()
-        : find_closest_mesh_point_of_type(INVALID, nearby, true);
+        : find_closest_mesh_point_of_type(INVALID, near_pos, true);
 
       if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
         const float measured_z = probe.probe_at_point(best.meshpos(), stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity);
         z_values[best.pos.x][best.pos.y] = isnan(measured_z) ? HUGE_VALF : measured_z;  // Mark invalid point already probed with HUGE_VALF to omit it in the next loop
+        TERN_(PROBE_SWEEP, near_pos = best.meshpos() - probe.offset_xy);
         #if ENABLED(EXTENSIBLE_UI)
           ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_FINISH);
           ExtUI::onMeshUpdate(best.pos, measured_z);
@@ -806,6 +816,8 @@ void unified_bed_leveling::shift_mesh_height() {
 
     } while (best.pos.x >= 0 && --count);
 
+    TERN_(PROBE_SWEEP, probe.sweep_end());
+
     GRID_LOOP(x, y) if (z_values[x][y] == HUGE_VALF) z_values[x][y] = NAN; // Restore NAN for HUGE_VALF marks
 
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_FINISH));
@@ -1689,15 +1701,14 @@ void unified_bed_leveling::smart_fill_mesh() {
     // being extrapolated so that nearby points will have greater influence on
     // the point being extrapolated.  Then extrapolate the mesh point from WLSF.
 
-    static_assert((GRID_MAX_POINTS_Y) <= 16, "GRID_MAX_POINTS_Y too big");
-    uint16_t bitmap[GRID_MAX_POINTS_X] = { 0 };
+    MeshFlags valid{0};
     struct linear_fit_data lsf_results;
 
     SERIAL_ECHOPGM("Extrapolating mesh...");
 
     const float weight_scaled = weight_factor * _MAX(MESH_X_DIST, MESH_Y_DIST);
 
-    GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) SBI(bitmap[jx], jy);
+    GRID_LOOP(jx, jy) if (!isnan(z_values[jx][jy])) valid.mark(jx, jy);
 
     xy_pos_t ppos;
     for (uint8_t ix = 0; ix < GRID_MAX_POINTS_X; ++ix) {
@@ -1711,7 +1722,7 @@ void unified_bed_leveling::smart_fill_mesh() {
           for (uint8_t jx = 0; jx < GRID_MAX_POINTS_X; ++jx) {
             rpos.x = get_mesh_x(jx);
             for (uint8_t jy = 0; jy < GRID_MAX_POINTS_Y; ++jy) {
-              if (TEST(bitmap[jx], jy)) {
+              if (valid.marked(jx, jy)) {
                 rpos.y = get_mesh_y(jy);
                 const float rz = z_values[jx][jy],
                              w = 1.0f + weight_scaled / (rpos - ppos).magnitude();
@@ -32,6 +32,10 @@
   #include "../../../module/delta.h"
 #endif
 
+#if ENABLED(KINEMATIC_IK_LINEARIZE)
+  #include "../../../module/kinematic_pipeline.h"
+#endif
+
 #include "../../../MarlinCore.h"
 #include <math.h>
 
@@ -388,10 +392,16 @@
 
     // Just do plain segmentation if UBL is inactive or the target is above the fade height
     if (!planner.leveling_active || !planner.leveling_active_at_z(destination.z)) {
+      TERN_(KINEMATIC_IK_LINEARIZE, kinematicPipeline.start(scaled_fr_mm_s, hints));
       while (--segments) {
         raw += diff;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        #if ENABLED(KINEMATIC_IK_LINEARIZE)
+          kinematicPipeline.add(raw);
+        #else
+          planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        #endif
       }
+      TERN_(KINEMATIC_IK_LINEARIZE, kinematicPipeline.finish());
       planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
       return false; // Did not set current from destination
     }
@@ -405,6 +415,8 @@
     // Move to first segment destination
     raw += diff;
 
+    TERN_(KINEMATIC_IK_LINEARIZE, kinematicPipeline.start(scaled_fr_mm_s, hints));
+
     for (;;) {  // for each mesh cell encountered during the move
 
       // Compute mesh cell invariants that remain constant for all segments within cell.
@@ -463,7 +475,15 @@
           TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor); // apply fade factor to interpolated height
 
         const float oldz = raw.z; raw.z += z_cxcy;
-        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        #if ENABLED(KINEMATIC_IK_LINEARIZE)
+          if (segments) kinematicPipeline.add(raw);
+          else {
+            kinematicPipeline.finish();
+            planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+          }
+        #else
+          planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        #endif
         raw.z = oldz;
 
         if (segments == 0)                        // done with last segment
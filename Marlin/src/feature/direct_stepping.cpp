@@ -221,6 +221,73 @@ namespace DirectStepping {
     set_page_state(page_idx, PageState::FREE);
   }
 
+  template <>
+  bool PageManager::page_ok(const page_idx_t page_idx) {
+    CHECK_PAGE(page_idx, false);
+
+    return page_states[page_idx] == PageState::OK;
+  }
+
+  #if ENABLED(DIRECT_STEPPING_STREAM)
+
+    /**
+     * Count the steps of a page the same way the Stepper runs them, including
+     * a partial last segment. Pages without direction bits move along 'dir'.
+     */
+    xyze_long_t page_steps(const uint8_t * const page, const uint16_t num_steps, const AxisBits dir) {
+      int32_t count[4] = { 0 };
+
+      #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+
+        for (uint16_t s = 0; s < num_steps; s += Config::SEGMENT_STEPS) {
+          const uint8_t * const seg = &page[(s / Config::SEGMENT_STEPS) * 2],
+                        sd[4] = { uint8_t(seg[0] >> 4), uint8_t(seg[0] & 0xF), uint8_t(seg[1] >> 4), uint8_t(seg[1] & 0xF) },
+                        n = _MIN(num_steps - s, Config::SEGMENT_STEPS);
+          for (uint8_t a = 0; a < 4; ++a) {
+            int8_t c = 0;
+            for (uint8_t j = 0; j < n; ++j) c += pgm_read_byte(&segment_table[sd[a]][j]);
+            count[a] += sd[a] < 7 ? -c : c;
+          }
+        }
+
+      #elif STEPPER_PAGE_FORMAT == SP_4x2_256
+
+        for (uint16_t s = 0; s < num_steps; s += Config::SEGMENT_STEPS) {
+          const uint8_t b = page[s / Config::SEGMENT_STEPS],
+                        n = _MIN(num_steps - s, Config::SEGMENT_STEPS);
+          for (uint8_t a = 0; a < 4; ++a) {
+            const uint8_t sd = (b >> (6 - 2 * a)) & 0x3;
+            for (uint8_t j = 0; j < n; ++j) count[a] += pgm_read_byte(&segment_table[sd][j]);
+          }
+        }
+
+      #elif STEPPER_PAGE_FORMAT == SP_4x1_512
+
+        for (uint16_t s = 0; s < num_steps; ++s) {
+          uint8_t steps = page[s >> 1];
+          if (s & 0x1) steps >>= 4;
+          for (uint8_t a = 0; a < 4; ++a) if (TEST(steps, 3 - a)) count[a]++;
+        }
+
+      #endif
+
+      if (!Config::DIRECTIONAL) {
+        if (!dir.x) count[0] = -count[0];
+        if (!dir.y) count[1] = -count[1];
+        if (!dir.z) count[2] = -count[2];
+        TERN_(HAS_EXTRUDERS, if (!dir.e) count[3] = -count[3]);
+      }
+
+      xyze_long_t steps{0};
+      steps.x = count[0];
+      steps.y = count[1];
+      steps.z = count[2];
+      TERN_(HAS_EXTRUDERS, steps.e = count[3]);
+      return steps;
+    }
+
+  #endif // DIRECT_STEPPING_STREAM
+
 };
 
 DirectStepping::PageManager page_manager;
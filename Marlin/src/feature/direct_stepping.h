@@ -43,8 +43,6 @@ namespace DirectStepping {
     uint8_t segment_steps;
     // Segment delta
     xyze_uint8_t sd;
-    // Block delta
-    xyze_int_t bd;
   };
 
   template<typename Cfg>
@@ -60,6 +58,7 @@ namespace DirectStepping {
     static void init();
     static uint8_t *get_page(const page_idx_t page_idx);
     static void free_page(const page_idx_t page_idx);
+    static bool page_ok(const page_idx_t page_idx);
 
   protected:
 
@@ -113,6 +112,11 @@ namespace DirectStepping {
 
   template class PAGE_MANAGER<Config>;
   typedef PAGE_MANAGER<Config> PageManager;
+
+  #if ENABLED(DIRECT_STEPPING_STREAM)
+    // Steps made on each axis by the first 'num_steps' steps of a page
+    xyze_long_t page_steps(const uint8_t * const page, const uint16_t num_steps, const AxisBits dir);
+  #endif
 };
 
 #define SP_4x4D_128 1
@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * idle_scheduler.cpp - Deadline-aware scheduling of idle() tasks
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+
+#include "idle_scheduler.h"
+#include "../module/planner.h"
+
+IdleScheduler idle_scheduler;
+
+uint32_t IdleScheduler::pass_start_us;
+IdleScheduler::task_state_t IdleScheduler::state[TASK_COUNT];
+IdleScheduler::task_stats_t IdleScheduler::stats[TASK_COUNT];
+
+// Least time between runs of each task, in ms
+static constexpr uint16_t task_period[] = {
+  0,    // HEATERS
+  0,    // RUNOUT
+  0,    // RECOVERY
+  0,    // TMC_MONITOR (polls at its own interval)
+  100,  // MEDIA
+  100,  // ETHERNET
+  0,    // UI
+  0,    // ENCODERS (updates at I2CPE_MIN_UPD_TIME_MS)
+  0,    // REPORTS (report at their own intervals)
+  0,    // MMU
+  0,    // LVGL
+  0,    // MAX7219
+  0     // MESH
+};
+
+static constexpr IdleScheduler::Priority task_priority[] = {
+  IdleScheduler::CRITICAL,    // HEATERS (also feeds the watchdog)
+  IdleScheduler::CRITICAL,    // RUNOUT
+  IdleScheduler::CRITICAL,    // RECOVERY
+  IdleScheduler::NORMAL,      // TMC_MONITOR
+  IdleScheduler::BACKGROUND,  // MEDIA
+  IdleScheduler::BACKGROUND,  // ETHERNET
+  IdleScheduler::BACKGROUND,  // UI
+  IdleScheduler::NORMAL,      // ENCODERS
+  IdleScheduler::BACKGROUND,  // REPORTS
+  IdleScheduler::NORMAL,      // MMU
+  IdleScheduler::BACKGROUND,  // LVGL
+  IdleScheduler::BACKGROUND,  // MAX7219
+  IdleScheduler::BACKGROUND   // MESH
+};
+
+static_assert(COUNT(task_period) == IdleScheduler::TASK_COUNT, "task_period needs an entry for each idle task.");
+static_assert(COUNT(task_priority) == IdleScheduler::TASK_COUNT, "task_priority needs an entry for each idle task.");
+
+bool IdleScheduler::planner_low() {
+  return planner.has_blocks_queued() && planner.movesplanned() < (IDLE_TASK_LOW_WATER);
+}
+
+bool IdleScheduler::due(const Task t) {
+  task_state_t &s = state[t];
+  const millis_t ms = millis();
+  if (task_period[t] && PENDING(ms, s.next_ms)) return false;
+
+  const Priority p = task_priority[t];
+  if (p == CRITICAL) return true;
+
+  // A task that has waited long enough runs anyway
+  if (s.waiting_ms && ELAPSED(ms, s.waiting_ms + (IDLE_TASK_MAX_DEFER))) return true;
+
+  const bool wait = (p == BACKGROUND && planner_low())
+                 || micros() - pass_start_us + s.estimate_us > (IDLE_TASK_BUDGET_US);
+  if (!wait) return true;
+
+  if (!s.waiting_ms) s.waiting_ms = ms ?: 1;
+  stats[t].deferred++;
+  return false;
+}
+
+void IdleScheduler::done(const Task t, const uint32_t start_us) {
+  const uint32_t us = micros() - start_us;
+
+  task_state_t &s = state[t];
+  s.waiting_ms = 0;
+  if (task_period[t]) s.next_ms = millis() + task_period[t];
+  s.estimate_us = _MIN((uint32_t(s.estimate_us) * 3 + us) / 4, uint32_t(UINT16_MAX));
+
+  task_stats_t &st = stats[t];
+  st.runs++;
+  st.total_us += us;
+  NOLESS(st.max_us, us);
+}
+
+void IdleScheduler::reset() {
+  ZERO(stats);
+}
+
+void IdleScheduler::report() {
+  static const char * const task_name[TASK_COUNT] = {
+    "heaters", "runout", "recovery", "tmc", "media", "ethernet", "ui",
+    "encoders", "reports", "mmu", "lvgl", "max7219", "mesh"
+  };
+
+  SERIAL_ECHOLNPGM("Idle Task Profile (us)");
+  for (uint8_t t = 0; t < TASK_COUNT; ++t) {
+    const task_stats_t &s = stats[t];
+    if (!s.runs && !s.deferred) continue;
+    SERIAL_ECHOLNPGM(" ", task_name[t], " runs:", s.runs, " avg:", s.runs ? uint32_t(s.total_us / s.runs) : 0UL,
+                     " max:", s.max_us, " deferred:", s.deferred);
+  }
+}
+
+#endif // IDLE_TASK_SCHEDULER
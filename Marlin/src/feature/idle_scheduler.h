@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_scheduler.h - Deadline-aware scheduling of idle() tasks
+ *
+ * Each idle() task has a period, a priority and an estimate of its run time.
+ * Critical tasks run on every pass. Normal tasks wait for the next pass when
+ * their estimate won't fit in what is left of IDLE_TASK_BUDGET_US. Background
+ * tasks also wait while the planner is running low, so control returns to the
+ * command queue sooner. No task is held back longer than IDLE_TASK_MAX_DEFER.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class IdleScheduler {
+public:
+  enum Task : uint8_t {
+    HEATERS, RUNOUT, RECOVERY, TMC_MONITOR, MEDIA, ETHERNET, UI,
+    ENCODERS, REPORTS, MMU, LVGL, MAX7219, MESH, TASK_COUNT
+  };
+
+  enum Priority : uint8_t { CRITICAL, NORMAL, BACKGROUND };
+
+  typedef struct {
+    uint32_t runs, deferred;
+    uint64_t total_us;
+    uint32_t max_us;
+  } task_stats_t;
+
+  // Start timing a pass through idle()
+  static void start_pass() { pass_start_us = micros(); }
+
+  // Check whether a task should run on this pass
+  static bool due(const Task t);
+
+  // Record the run of a task that started at 'start_us'
+  static void done(const Task t, const uint32_t start_us);
+
+  static void reset();
+  static void report();
+
+private:
+  typedef struct {
+    millis_t next_ms,             // Next time a periodic task is due
+             waiting_ms;          // When the task was first held back, or 0
+    uint16_t estimate_us;         // Recent run time of the task
+  } task_state_t;
+
+  static uint32_t pass_start_us;
+  static task_state_t state[TASK_COUNT];
+  static task_stats_t stats[TASK_COUNT];
+
+  // A move is running with few others behind it
+  static bool planner_low();
+};
+
+extern IdleScheduler idle_scheduler;
+
+// Run a statement as an idle() task when the scheduler says it is due. TRACE_SPAN adds it to the LATENCY_TRACE.
+#define IDLE_TASK(T, F) do{ if (idle_scheduler.due(IdleScheduler::T)) { const uint32_t _idle_task_start = micros(); TRACE_SPAN(T, F); idle_scheduler.done(IdleScheduler::T, _idle_task_start); } }while(0)
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * isr_profiler.cpp - Stepper ISR cycle-budget profiler
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+
+#include "isr_profiler.h"
+
+IsrProfiler isr_profiler;
+
+IsrProfiler::phase_stats_t IsrProfiler::stats[PHASE_COUNT];
+AutoReporter<IsrProfiler::AutoReport> IsrProfiler::auto_reporter;
+
+void IsrProfiler::init() {
+  #if ISR_PROFILE_DWT
+    // Enable the DWT cycle counter, if present (as done for the delay loop)
+    #define HW_REG(X) *(volatile uint32_t *)(X)
+    if (HW_REG(0xE0001000)) {                       // DWT_CTRL
+      HW_REG(0xE000EDFC) |= 0x01000000;             // DEMCR: Enable trace
+      #if __CORTEX_M == 7
+        HW_REG(0xE0001FB0) = 0xC5ACCE55;            // DWT_LAR: Unlock access to DWT registers
+      #endif
+      HW_REG(0xE0001000) |= 1;                      // DWT_CTRL: Enable the cycle counter
+    }
+    #undef HW_REG
+  #endif
+  reset();
+}
+
+void IsrProfiler::reset() {
+  hal.isr_off();
+  ZERO(stats);
+  hal.isr_on();
+}
+
+void IsrProfiler::report() {
+  static const char * const phase_name[PHASE_COUNT] = { "isr", "pulse", "block", "advance", "shaping", "ftmotion" };
+
+  // Take a consistent copy of the statistics
+  phase_stats_t st[PHASE_COUNT];
+  hal.isr_off();
+  COPY(st, stats);
+  hal.isr_on();
+
+  SERIAL_ECHOLNPGM("Stepper ISR Profile (" ISR_PROFILE_UNITS ", ", uint32_t(ISR_PROFILE_TICK_RATE), "/s)");
+  for (uint8_t p = 0; p < PHASE_COUNT; ++p) {
+    const phase_stats_t &s = st[p];
+    if (!s.calls) continue;
+    const uint32_t avg = uint32_t(s.total_ticks / s.calls);
+    SERIAL_ECHOLNPGM(" ", phase_name[p], " calls:", s.calls, " min:", uint32_t(s.min_ticks), " avg:", avg, " max:", uint32_t(s.max_ticks));
+    SERIAL_ECHOPGM("  ");
+    for (uint8_t b = 0; b < HISTOGRAM_BUCKETS; ++b) {
+      if (!s.histogram[b]) continue;
+      if (b < HISTOGRAM_BUCKETS - 1) SERIAL_ECHOPGM(" <", 1UL << b); else SERIAL_ECHOPGM(" >=", 1UL << (b - 1));
+      SERIAL_ECHOPGM(":", s.histogram[b]);
+    }
+    SERIAL_EOL();
+  }
+
+  // The whole-ISR average and maximum limit the sustainable ISR rate
+  const phase_stats_t &isr = st[ISR_TOTAL];
+  if (isr.calls && isr.total_ticks && isr.max_ticks)
+    SERIAL_ECHOLNPGM(" Max ISR rate avg:", uint32_t(uint64_t(ISR_PROFILE_TICK_RATE) * isr.calls / isr.total_ticks),
+                     "Hz worst:", uint32_t(ISR_PROFILE_TICK_RATE / isr.max_ticks), "Hz");
+}
+
+#endif // STEPPER_ISR_PROFILER
@@ -0,0 +1,105 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Stepper ISR cycle-budget profiler
+ *
+ * Time the whole Stepper ISR and each of its phases, keeping the call count,
+ * min / avg / max and a power-of-2 histogram of the time spent per call.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+#ifdef __PLAT_NATIVE_SIM__
+  #include <time.h>
+  typedef uint32_t isr_ticks_t;
+  #define ISR_PROFILE_TICK_RATE 1000000000UL    // clock_gettime nanoseconds
+  #define ISR_PROFILE_UNITS     "ns"
+#elif (defined(__arm__) || defined(__thumb__)) && !defined(__ARM_ARCH_6M__)
+  typedef uint32_t isr_ticks_t;
+  #define ISR_PROFILE_TICK_RATE (F_CPU)         // DWT cycle counter
+  #define ISR_PROFILE_UNITS     "cycles"
+  #define ISR_PROFILE_DWT 1
+#else
+  typedef hal_timer_t isr_ticks_t;
+  #define ISR_PROFILE_TICK_RATE (STEPPER_TIMER_RATE) // Stepper timer, reset at each Stepper ISR
+  #define ISR_PROFILE_UNITS     "ticks"
+#endif
+
+class IsrProfiler {
+public:
+  // Profiled parts of the Stepper ISR
+  enum Phase : uint8_t { ISR_TOTAL, PULSE_PHASE, BLOCK_PHASE, ADVANCE, SHAPING, FT_MOTION, PHASE_COUNT };
+
+  // Histogram buckets, each a power of 2 in ticks
+  static constexpr uint8_t HISTOGRAM_BUCKETS = 16;
+
+  typedef struct {
+    uint32_t calls;
+    isr_ticks_t min_ticks, max_ticks;
+    uint64_t total_ticks;
+    uint32_t histogram[HISTOGRAM_BUCKETS];
+  } phase_stats_t;
+
+  static void init();
+  static void reset();
+
+  static isr_ticks_t now() {
+    #ifdef __PLAT_NATIVE_SIM__
+      timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+      return isr_ticks_t(ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+    #elif ISR_PROFILE_DWT
+      return *(volatile uint32_t *)0xE0001004; // DWT_CYCCNT
+    #else
+      return HAL_timer_get_count(MF_TIMER_STEP);
+    #endif
+  }
+
+  // Record the time since 'start' for a phase. Called from the Stepper ISR.
+  static void record(const Phase p, const isr_ticks_t start) {
+    const isr_ticks_t ticks = now() - start;
+    phase_stats_t &s = stats[p];
+    if (!s.calls || ticks < s.min_ticks) s.min_ticks = ticks;
+    if (ticks > s.max_ticks) s.max_ticks = ticks;
+    s.total_ticks += ticks;
+    s.calls++;
+    uint8_t b = 0;
+    for (isr_ticks_t t = ticks; t && b < HISTOGRAM_BUCKETS - 1; t >>= 1) b++;
+    s.histogram[b]++;
+  }
+
+  static void report();
+
+  struct AutoReport { static void report() { IsrProfiler::report(); } };
+  static AutoReporter<AutoReport> auto_reporter;
+
+private:
+  static phase_stats_t stats[PHASE_COUNT];
+};
+
+extern IsrProfiler isr_profiler;
+
+// Time a statement as one phase of the Stepper ISR
+#define ISR_PROFILE(P, F) do{ const isr_ticks_t _isr_prof_start = IsrProfiler::now(); F; isr_profiler.record(IsrProfiler::P, _isr_prof_start); }while(0)
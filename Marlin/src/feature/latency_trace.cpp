@@ -0,0 +1,137 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * latency_trace.cpp - Main loop latency tracer
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(LATENCY_TRACE)
+
+#include "latency_trace.h"
+
+#ifdef __PLAT_NATIVE_SIM__
+  #include <stdio.h>
+#endif
+
+LatencyTrace latency_trace;
+
+bool LatencyTrace::enabled = true;
+LatencyTrace::entry_t LatencyTrace::ring[LATENCY_TRACE_SIZE];
+uint16_t LatencyTrace::head, LatencyTrace::count;
+
+static PGMSTR(tag_idle, "idle");
+static PGMSTR(tag_queue, "queue");
+static PGMSTR(tag_command, "command");
+static PGMSTR(tag_heaters, "heaters");
+static PGMSTR(tag_runout, "runout");
+static PGMSTR(tag_recovery, "recovery");
+static PGMSTR(tag_tmc, "tmc");
+static PGMSTR(tag_media, "media");
+static PGMSTR(tag_ethernet, "ethernet");
+static PGMSTR(tag_ui, "ui");
+static PGMSTR(tag_encoders, "encoders");
+static PGMSTR(tag_reports, "reports");
+static PGMSTR(tag_mmu, "mmu");
+static PGMSTR(tag_lvgl, "lvgl");
+static PGMSTR(tag_max7219, "max7219");
+static PGMSTR(tag_mesh, "mesh");
+static PGMSTR(tag_unknown, "?");
+
+static PGM_P const tag_name[LatencyTrace::TAG_COUNT] PROGMEM = {
+  tag_idle, tag_queue, tag_command,
+  tag_heaters, tag_runout, tag_recovery, tag_tmc, tag_media, tag_ethernet, tag_ui,
+  tag_encoders, tag_reports, tag_mmu, tag_lvgl, tag_max7219, tag_mesh
+};
+
+// One CSV line: time (us), '+' start or '-' end, tag, command
+void LatencyTrace::format(char * const buf, const entry_t &e) {
+  const uint8_t t = e.tag & ~TAG_END;
+  PGM_P const name = t < TAG_COUNT ? (PGM_P)pgm_read_ptr(&tag_name[t]) : tag_unknown;
+  sprintf_P(buf, PSTR("%lu,%c," S_FMT ","), (unsigned long)e.us, (e.tag & TAG_END) ? '-' : '+', name);
+  if (e.letter) sprintf_P(buf + strlen(buf), PSTR("%c%u"), e.letter, e.code);
+}
+
+void LatencyTrace::dump_csv() {
+  const bool was_enabled = enabled;
+  enabled = false;
+
+  char buf[40];
+  SERIAL_ECHOLNPGM("latency_trace:", count);
+  for (uint16_t i = 0; i < count; ++i) {
+    format(buf, oldest(i));
+    SERIAL_ECHOLN(buf);
+  }
+
+  enabled = was_enabled;
+}
+
+/**
+ * Dump the trace as "latency_trace_bin:<count>", a newline, and then 8 bytes
+ * per entry: the time (4 bytes), the command number (2 bytes), both little
+ * endian, the tag and the command letter. A final XOR checksum byte follows.
+ */
+void LatencyTrace::dump_binary() {
+  const bool was_enabled = enabled;
+  enabled = false;
+
+  SERIAL_ECHOLNPGM("latency_trace_bin:", count);
+  uint8_t crc = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    const entry_t &e = oldest(i);
+    const uint8_t bytes[8] = {
+      uint8_t(e.us), uint8_t(e.us >> 8), uint8_t(e.us >> 16), uint8_t(e.us >> 24),
+      uint8_t(e.code), uint8_t(e.code >> 8), e.tag, uint8_t(e.letter)
+    };
+    for (uint8_t b = 0; b < 8; ++b) { crc ^= bytes[b]; SERIAL_CHAR(bytes[b]); }
+  }
+  SERIAL_CHAR(crc);
+  SERIAL_EOL();
+
+  enabled = was_enabled;
+}
+
+#ifdef __PLAT_NATIVE_SIM__
+
+  void LatencyTrace::dump_file() {
+    FILE * const f = fopen(LATENCY_TRACE_FILE, "w");
+    if (!f) {
+      SERIAL_ERROR_MSG("Can't write " LATENCY_TRACE_FILE);
+      return;
+    }
+
+    char buf[40];
+    fputs("us,event,task,command\n", f);
+    for (uint16_t i = 0; i < count; ++i) {
+      format(buf, oldest(i));
+      fputs(buf, f);
+      fputc('\n', f);
+    }
+    fclose(f);
+
+    SERIAL_ECHOLNPGM("Wrote ", count, " entries to " LATENCY_TRACE_FILE);
+  }
+
+#endif
+
+#endif // LATENCY_TRACE
@@ -0,0 +1,103 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * latency_trace.h - Main loop latency tracer
+ *
+ * Log the time each idle() task, queue pass and command starts and ends
+ * in a ring buffer. The oldest entries are overwritten, so a dump shows
+ * what the main loop was doing just before a stall or planner underrun.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef LATENCY_TRACE_FILE
+  #define LATENCY_TRACE_FILE "latency_trace.csv"
+#endif
+
+class LatencyTrace {
+public:
+  // Traced parts of the main loop. Idle tasks share their names with IdleScheduler::Task.
+  enum Tag : uint8_t {
+    IDLE, QUEUE, COMMAND,
+    HEATERS, RUNOUT, RECOVERY, TMC_MONITOR, MEDIA, ETHERNET, UI,
+    ENCODERS, REPORTS, MMU, LVGL, MAX7219, MESH, TAG_COUNT
+  };
+
+  // Set in 'tag' for the end of a span
+  static constexpr uint8_t TAG_END = 0x80;
+
+  typedef struct {
+    uint32_t us;      // Time from micros()
+    uint16_t code;    // Command number, for COMMAND
+    uint8_t tag;      // Tag, plus TAG_END
+    char letter;      // Command letter, for COMMAND
+  } entry_t;
+
+  // Scoped span, logged when created and when it goes out of scope
+  class Span {
+    const Tag tag;
+    const char letter;
+    const uint16_t code;
+  public:
+    Span(const Tag t, const char l=0, const uint16_t c=0) : tag(t), letter(l), code(c) { record(tag, letter, code); }
+    ~Span() { record(uint8_t(tag) | TAG_END, letter, code); }
+  };
+
+  static bool enabled;
+
+  static void record(const uint8_t tag, const char letter, const uint16_t code) {
+    if (!enabled) return;
+    entry_t &e = ring[head];
+    e.us = micros();
+    e.code = code;
+    e.tag = tag;
+    e.letter = letter;
+    if (++head == LATENCY_TRACE_SIZE) head = 0;
+    if (count < LATENCY_TRACE_SIZE) count++;
+  }
+
+  static void clear() { head = count = 0; }
+
+  static void dump_csv();
+  static void dump_binary();
+  #ifdef __PLAT_NATIVE_SIM__
+    static void dump_file();
+  #endif
+
+private:
+  static entry_t ring[LATENCY_TRACE_SIZE];
+  static uint16_t head, count;
+
+  static const entry_t& oldest(const uint16_t i) {
+    const uint16_t n = head + LATENCY_TRACE_SIZE - count + i;
+    return ring[n < LATENCY_TRACE_SIZE ? n : n - LATENCY_TRACE_SIZE];
+  }
+
+  static void format(char * const buf, const entry_t &e);
+};
+
+extern LatencyTrace latency_trace;
+
+// Trace a statement as one span
+#define TRACE_SPAN(T, F) do{ const LatencyTrace::Span _trace_span(LatencyTrace::T); F; }while(0)
@@ -0,0 +1,184 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_benchmark.cpp - Host-side planner benchmark for the native simulator
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_BENCHMARK)
+
+#include "planner_benchmark.h"
+
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+
+#include <stdio.h>
+#include <time.h>
+
+PlannerBenchmark planner_benchmark;
+
+PlannerBenchmark::section_stats_t PlannerBenchmark::stats[SECTION_COUNT];
+uint32_t PlannerBenchmark::blocks, PlannerBenchmark::commands, PlannerBenchmark::underruns;
+uint64_t PlannerBenchmark::start_ns, PlannerBenchmark::busy_until;
+bool PlannerBenchmark::starved, PlannerBenchmark::done;
+
+static FILE *bench_file; // = nullptr
+static bool input_done; // = false
+
+uint64_t PlannerBenchmark::now_ns() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+void PlannerBenchmark::record(const Section s, const uint32_t ns) {
+  section_stats_t &st = stats[s];
+  if (!st.calls || ns < st.min_ns) st.min_ns = ns;
+  NOLESS(st.max_ns, ns);
+  st.calls++;
+  st.total_ns += ns;
+  uint8_t b = 0;
+  for (uint32_t n = ns >> 1; n && b < HISTOGRAM_BUCKETS - 1; n >>= 1) b++;
+  st.histogram[b]++;
+}
+
+/**
+ * The time the Stepper would spend on a block, from its trapezoid.
+ * Sync blocks take no time.
+ */
+static uint32_t block_duration_ns(block_t * const block) {
+  if (!block->is_move() || !block->nominal_rate) return 0;
+  const float accel = block->acceleration_steps_per_s2,
+              initial = block->initial_rate, final = block->final_rate,
+              accel_steps = block->accelerate_before,
+              decel_steps = block->step_event_count - block->decelerate_start,
+              cruise_steps = _MAX(0.0f, float(block->step_event_count) - accel_steps - decel_steps),
+              peak = _MIN(float(block->nominal_rate), SQRT(sq(initial) + 2 * accel * accel_steps));
+  float secs = cruise_steps / peak;
+  if (accel_steps) secs += 2 * accel_steps / (initial + peak);
+  if (decel_steps) secs += 2 * decel_steps / (peak + final);
+  return uint32_t(secs * 1e9f / (PLANNER_BENCHMARK_TIME_SCALE));
+}
+
+/**
+ * Copy lines from the benchmark file into the command queue, stripping
+ * comments and blank lines. Commands are processed by the main loop.
+ */
+void PlannerBenchmark::feed_commands() {
+  if (input_done) return;
+
+  if (!bench_file) {
+    bench_file = fopen(PLANNER_BENCHMARK_FILE, "r");
+    if (!bench_file) {
+      SERIAL_ERROR_MSG("Benchmark file not found: " PLANNER_BENCHMARK_FILE);
+      input_done = done = true;
+      return;
+    }
+    SERIAL_ECHOLNPGM("Planner Benchmark: " PLANNER_BENCHMARK_FILE);
+    start_ns = now_ns();
+  }
+
+  char line[MAX_CMD_SIZE];
+  while (!queue.ring_buffer.full()) {
+    if (!fgets(line, sizeof(line), bench_file)) {
+      fclose(bench_file);
+      bench_file = nullptr;
+      input_done = true;
+      return;
+    }
+    char *cmd = line;
+    while (*cmd == ' ') cmd++;
+    for (char *c = cmd; *c; c++) if (*c == ';' || ISEOL(*c)) { *c = '\0'; break; }
+    if (*cmd && queue.ring_buffer.enqueue(cmd)) commands++;
+  }
+}
+
+/**
+ * Stand in for the Stepper ISR. Take the next block once the current one
+ * has run for its planned duration, counting an underrun whenever the
+ * planner runs dry while commands are still coming.
+ */
+void PlannerBenchmark::consume_blocks() {
+  static bool holding = false;
+  const uint64_t now = now_ns();
+
+  if (holding) {
+    if (now < busy_until) return;
+    planner.release_current_block();
+    holding = false;
+  }
+
+  block_t * const block = planner.get_current_block();
+  if (block) {
+    holding = true;
+    starved = false;
+    blocks++;
+    busy_until = _MAX(busy_until, now) + block_duration_ns(block);
+    return;
+  }
+
+  // Nothing to run. Is the planner starving?
+  if (blocks && !starved && (!input_done || queue.has_commands_queued())) {
+    starved = true;
+    underruns++;
+  }
+  busy_until = now;
+}
+
+void PlannerBenchmark::task() {
+  if (done) return;
+
+  feed_commands();
+  consume_blocks();
+
+  if (input_done && !queue.has_commands_queued() && !planner.has_blocks_queued()) {
+    done = true;
+    report();
+  }
+}
+
+void PlannerBenchmark::report() {
+  static const char * const section_name[SECTION_COUNT] = { "populate_block", "reverse_pass", "recalculate_trapezoids" };
+
+  const float elapsed_s = (now_ns() - start_ns) * 1e-9f;
+  uint64_t planner_ns = 0;
+  for (uint8_t s = 0; s < SECTION_COUNT; ++s) planner_ns += stats[s].total_ns;
+
+  SERIAL_ECHOLNPGM("Planner Benchmark Report");
+  SERIAL_ECHOLNPGM(" Commands:", commands, " Blocks:", blocks, " Elapsed:", p_float_t(elapsed_s, 3), "s");
+  SERIAL_ECHOLNPGM(" Planner time:", p_float_t(planner_ns * 1e-6f, 3), "ms Blocks/s:", planner_ns ? uint32_t(blocks * 1e9f / planner_ns) : 0UL);
+  SERIAL_ECHOLNPGM(" Underruns:", underruns, " Time scale:", p_float_t(PLANNER_BENCHMARK_TIME_SCALE, 2));
+
+  for (uint8_t s = 0; s < SECTION_COUNT; ++s) {
+    const section_stats_t &st = stats[s];
+    SERIAL_ECHOLNPGM(" ", section_name[s], " calls:", st.calls,
+      " min:", st.min_ns, "ns avg:", st.calls ? uint32_t(st.total_ns / st.calls) : 0UL, "ns max:", st.max_ns, "ns");
+    SERIAL_ECHOPGM("  ");
+    for (uint8_t b = 0; b < HISTOGRAM_BUCKETS; ++b)
+      if (st.histogram[b]) SERIAL_ECHOPGM(" <", 2UL << b, "ns:", st.histogram[b]);
+    SERIAL_EOL();
+  }
+}
+
+#endif // PLANNER_BENCHMARK
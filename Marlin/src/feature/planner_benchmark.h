@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_benchmark.h - Host-side planner benchmark for the native simulator
+ *
+ * Stream a recorded G-code file through the command queue and the planner
+ * while the Stepper ISR is stubbed out. Blocks are consumed from idle() at
+ * their planned duration so planner throughput and buffer underruns can be
+ * measured without real hardware.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#ifndef PLANNER_BENCHMARK_FILE
+  #define PLANNER_BENCHMARK_FILE "benchmark.gcode"
+#endif
+#ifndef PLANNER_BENCHMARK_TIME_SCALE
+  #define PLANNER_BENCHMARK_TIME_SCALE 1.0f
+#endif
+
+class PlannerBenchmark {
+public:
+  // Timed sections of the planner
+  enum Section : uint8_t { POPULATE_BLOCK, REVERSE_PASS, RECALC_TRAPEZOIDS, SECTION_COUNT };
+
+  // Timing histogram buckets, each a power of 2 in nanoseconds
+  static constexpr uint8_t HISTOGRAM_BUCKETS = 24;
+
+  typedef struct {
+    uint32_t calls, min_ns, max_ns;
+    uint64_t total_ns;
+    uint32_t histogram[HISTOGRAM_BUCKETS];
+  } section_stats_t;
+
+  // Scoped timer for one planner section
+  class Timer {
+    const Section section;
+    const uint64_t start_ns;
+  public:
+    Timer(const Section s) : section(s), start_ns(now_ns()) {}
+    ~Timer() { record(section, uint32_t(now_ns() - start_ns)); }
+  };
+
+  static uint64_t now_ns();
+  static void record(const Section s, const uint32_t ns);
+
+  // Feed G-code and consume planner blocks. Called from idle().
+  static void task();
+
+  static void report();
+
+private:
+  static section_stats_t stats[SECTION_COUNT];
+  static uint32_t blocks, commands, underruns;
+  static uint64_t start_ns,   // Time the first command was queued
+                  busy_until; // Virtual time the current block completes
+  static bool starved, done;
+
+  static void feed_commands();
+  static void consume_blocks();
+};
+
+extern PlannerBenchmark planner_benchmark;
+
+#define PLANNER_BENCH_SECTION(S) const PlannerBenchmark::Timer _bench_timer(PlannerBenchmark::S)
@@ -147,7 +147,7 @@
 #define G26_ERR true
 
 #if ENABLED(ARC_SUPPORT)
-  void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t);
+  void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t, const bool);
 #endif
 
 constexpr float g26_e_axis_feedrate = 0.025;
@@ -784,7 +784,7 @@ void GcodeSuite::G26() {
         g26.recover_filament(destination);
 
         { REMEMBER(fr, feedrate_mm_s, PLANNER_XY_FEEDRATE() * 0.1f);
-          plan_arc(endpoint, arc_offset, false, 0);  // Draw a counter-clockwise arc
+          plan_arc(endpoint, arc_offset, false, 0, false);  // Draw a counter-clockwise arc
           destination = current_position;
         }
 
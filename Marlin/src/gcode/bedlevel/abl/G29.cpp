@@ -141,6 +141,89 @@ public:
   constexpr grid_count_t G29_State::abl_points;
 #endif
 
+#if ENABLED(ABL_ADAPTIVE_GRID)
+
+  // Grid lines probed on the first pass, always including the last one
+  static bool on_coarse_grid(const uint8_t i, const uint8_t n) {
+    return i % (ABL_ADAPTIVE_STRIDE) == 0 || i == n - 1;
+  }
+
+  // Number of grid lines probed on the first pass
+  static constexpr uint8_t coarse_lines(const uint8_t n) {
+    return (n - 2) / (ABL_ADAPTIVE_STRIDE) + 2;
+  }
+
+  /**
+   * Second pass of adaptive probing. Each cell of the coarse grid is filled in
+   * by bilinear interpolation of its corners, then the point nearest its center
+   * is probed. If that point is more than ABL_ADAPTIVE_TOLERANCE off the rest
+   * of the cell is probed too. A cell with an unprobed corner is always probed.
+   *
+   * Return false if probing failed.
+   */
+  static bool refine_grid(G29_State &abl, MeshFlags &probed, const ProbePtRaise raise_after, const bool faux) {
+    auto probe_point = [&](const uint8_t i, const uint8_t j) {
+      if (probed.marked(i, j)) return true;
+      abl.meshCount.set(i, j);
+      abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+      if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) return true;
+
+      if (abl.verbose_level) SERIAL_ECHOLNPGM("Refining mesh point ", i, ",", j, ".");
+      abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+      if (isnan(abl.measured_z)) return false;
+
+      const float z = abl.measured_z + abl.Z_offset;
+      abl.z_values[i][j] = z;
+      probed.mark(i, j);
+      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+      idle_no_sleep();
+      return true;
+    };
+
+    bool zig = true;
+    for (uint8_t y0 = 0; y0 < GRID_MAX_POINTS_Y - 1; y0 += ABL_ADAPTIVE_STRIDE) {
+      const uint8_t y1 = _MIN(y0 + (ABL_ADAPTIVE_STRIDE), GRID_MAX_POINTS_Y - 1);
+      for (uint8_t c = 0; c < GRID_MAX_POINTS_X - 1; c += ABL_ADAPTIVE_STRIDE) {
+        // Serpentine order of cells
+        const uint8_t x0 = zig ? c : ((GRID_MAX_POINTS_X - 2) / (ABL_ADAPTIVE_STRIDE) * (ABL_ADAPTIVE_STRIDE)) - c,
+                      x1 = _MIN(x0 + (ABL_ADAPTIVE_STRIDE), GRID_MAX_POINTS_X - 1);
+
+        bool refine = !(probed.marked(x0, y0) && probed.marked(x1, y0) && probed.marked(x0, y1) && probed.marked(x1, y1));
+
+        if (!refine) {
+          const float z00 = abl.z_values[x0][y0], z10 = abl.z_values[x1][y0],
+                      z01 = abl.z_values[x0][y1], z11 = abl.z_values[x1][y1];
+          auto interpolated = [&](const uint8_t i, const uint8_t j) {
+            const float tx = float(i - x0) / (x1 - x0), ty = float(j - y0) / (y1 - y0),
+                        z0 = z00 + (z10 - z00) * tx, z1 = z01 + (z11 - z01) * tx;
+            return z0 + (z1 - z0) * ty;
+          };
+
+          for (uint8_t j = y0; j <= y1; ++j)
+            for (uint8_t i = x0; i <= x1; ++i)
+              if (!probed.marked(i, j)) abl.z_values[i][j] = interpolated(i, j);
+
+          // Compare the center to the interpolated value
+          const uint8_t ci = (x0 + x1) / 2, cj = (y0 + y1) / 2;
+          if (!probed.marked(ci, cj)) {
+            const float zi = abl.z_values[ci][cj];
+            if (!probe_point(ci, cj)) return false;
+            refine = probed.marked(ci, cj) && ABS(abl.z_values[ci][cj] - zi) > (ABL_ADAPTIVE_TOLERANCE);
+          }
+        }
+
+        if (refine)
+          for (uint8_t j = y0; j <= y1; ++j)
+            for (uint8_t i = x0; i <= x1; ++i)
+              if (!probe_point(i, j)) return false;
+      }
+      zig ^= true;
+    }
+    return true;
+  }
+
+#endif // ABL_ADAPTIVE_GRID
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -217,6 +300,10 @@ public:
  *  E  By default G29 will engage the Z probe, test the bed, then disengage.
  *     Include "E" to engage/disengage the Z probe for each sample.
  *     There's no extra effect if you have a fixed Z probe.
+ *
+ * With ABL_ADAPTIVE_GRID:
+ *
+ *  U  Use adaptive probing. Default 1. "G29 U0" probes every point.
  */
 G29_TYPE GcodeSuite::G29() {
 
@@ -649,10 +736,25 @@ G29_TYPE GcodeSuite::G29() {
 
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
+      #if ENABLED(ABL_ADAPTIVE_GRID)
+        const bool adaptive = parser.boolval('U', true);
+        MeshFlags probed{0};
+        // Count only the points probed on the first pass
+        grid_count_t coarse_index = 0;
+        const grid_count_t coarse_points = adaptive ? grid_count_t(coarse_lines(GRID_MAX_POINTS_X)) * coarse_lines(GRID_MAX_POINTS_Y) : abl.abl_points;
+      #endif
+
+      TERN_(PROBE_SWEEP, if (!faux) probe.sweep_start());
+
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
       for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
 
+        // Leave the lines between the coarse grid for refine_grid()
+        #if ENABLED(ABL_ADAPTIVE_GRID)
+          if (adaptive && !on_coarse_grid(PR_OUTER_VAR, PR_OUTER_SIZE)) continue;
+        #endif
+
         int8_t inStart, inStop, inInc;
 
         if (zig) {                      // Zig away from origin
@@ -682,9 +784,17 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
-          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
+          #if ENABLED(ABL_ADAPTIVE_GRID)
+            if (adaptive && !on_coarse_grid(PR_INNER_VAR, PR_INNER_SIZE)) continue;
+            const grid_count_t pt_num = adaptive ? ++coarse_index : pt_index,
+                               pt_total = coarse_points;
+          #else
+            const grid_count_t pt_num = pt_index, pt_total = abl.abl_points;
+          #endif
+
+          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_num, "/", pt_total, ".");
             #if DISABLED(REMOVE_STARING_PRINT_MESSAGES)
-              TERN_(HAS_STATUS_MESSAGE && , ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+              TERN_(HAS_STATUS_MESSAGE && , ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT_F(MSG_PROBING_POINT), int(pt_num), int(pt_total)));
             #endif
 
           #if ENABLED(BD_SENSOR_PROBE_NO_STOP)
@@ -768,6 +878,7 @@ G29_TYPE GcodeSuite::G29() {
 
             const float z = abl.measured_z + abl.Z_offset;
             abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+            TERN_(ABL_ADAPTIVE_GRID, probed.mark(abl.meshCount));
             TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
 
           #endif
@@ -778,6 +889,13 @@ G29_TYPE GcodeSuite::G29() {
         } // inner
       } // outer
 
+      #if ENABLED(ABL_ADAPTIVE_GRID)
+        if (adaptive && !isnan(abl.measured_z) && !refine_grid(abl, probed, raise_after, faux))
+          set_bed_leveling_enabled(abl.reenable);
+      #endif
+
+      TERN_(PROBE_SWEEP, if (!faux) probe.sweep_end());
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
       // Probe at 3 arbitrary points
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_GCODE)
+
+#include "binary_gcode.h"
+
+/**
+ * Check a pre-parsed record (see binary_gcode.h) read from a file, so the
+ * parser can trust its letters, bits and values once it's queued.
+ */
+bool binary_gcode_valid(const uint8_t * const rec, const uint8_t len) {
+  if (len < BINARY_GCODE_VALUES || rec[0] != BINARY_GCODE_CMD) return false;
+
+  const char letter = rec[1];
+  if (letter != 'G' && letter != 'M' && letter != 'T') return false;
+
+  uint32_t codebits, valuebits;
+  memcpy(&codebits, &rec[5], sizeof(codebits));
+  memcpy(&valuebits, &rec[9], sizeof(valuebits));
+  if ((valuebits & ~codebits) || (codebits >> 26)) return false;
+
+  uint8_t i = BINARY_GCODE_VALUES;
+  for (; valuebits; valuebits &= valuebits - 1) {     // One float per value bit
+    if (i + sizeof(float) > len) return false;
+    float v;
+    memcpy(&v, &rec[i], sizeof(v));
+    i += sizeof(v);
+    if (!(ABS(v) < 1e9f)) return false;               // Also rejects NaN
+  }
+
+  return i == len;
+}
+
+#endif // BINARY_GCODE
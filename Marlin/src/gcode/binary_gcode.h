@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_gcode.h - Pre-tokenized G-code file format (*.GCB)
+ *
+ * A file starts with the 4-byte magic "MGCB" and a format version byte,
+ * followed by records of one length byte and up to MAX_CMD_SIZE - 1 bytes.
+ *
+ * A record starting with BINARY_GCODE_CMD holds a pre-parsed command:
+ *
+ *   [0]       BINARY_GCODE_CMD
+ *   [1]       Command letter (G, M, T)
+ *   [2..3]    Code number (uint16, little-endian)
+ *   [4]       Sub-code
+ *   [5..8]    Parameter letters present, bit 0 = 'A' (uint32)
+ *   [9..12]   Parameter letters with a value (uint32)
+ *   [13..]    One float32 per value, in letter order
+ *
+ * Any other record is a plain text command line, used for commands with
+ * string arguments and anything that needs the full text parser.
+ *
+ * BINARY_GCODE queues each record as it is. GCodeParser::parse() hands
+ * pre-parsed records to parse_binary(), which sets the parameter offsets to the
+ * float32 values, so no text is scanned or converted.
+ *
+ * Files are produced by buildroot/share/scripts/gcode2gcb.py.
+ * GCODE_MACRO_CACHE stores pre-parsed scripts in the same record format.
+ */
+
+#define BINARY_GCODE_MAGIC      "MGCB"
+#define BINARY_GCODE_VERSION    1
+#define BINARY_GCODE_HEADER_LEN 5
+
+#define BINARY_GCODE_CMD        0x01
+#define BINARY_GCODE_VALUES     13
+
+#if ENABLED(BINARY_GCODE)
+  // Check a pre-parsed record before it's queued. Return false if it's malformed.
+  bool binary_gcode_valid(const uint8_t * const rec, const uint8_t len);
+#endif
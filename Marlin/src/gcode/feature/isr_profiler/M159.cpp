@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(STEPPER_ISR_PROFILER)
+
+#include "../../gcode.h"
+#include "../../../feature/isr_profiler.h"
+
+/**
+ * M159: Report Stepper ISR timing
+ *
+ *  R          - Reset the statistics
+ *  S<seconds> - Set the auto-report interval (0 to disable)
+ */
+void GcodeSuite::M159() {
+  if (parser.seen_test('R')) {
+    isr_profiler.reset();
+    return;
+  }
+
+  if (parser.seenval('S')) {
+    isr_profiler.auto_reporter.set_interval(parser.value_byte());
+    return;
+  }
+
+  isr_profiler.report();
+}
+
+#endif // STEPPER_ISR_PROFILER
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(LATENCY_TRACE)
+
+#include "../../gcode.h"
+#include "../../../feature/latency_trace.h"
+
+/**
+ * M161: Dump the main loop latency trace
+ *
+ *  With no parameters dump the trace as CSV lines: time (µs), '+' start or '-' end, task, command
+ *
+ *  B          - Dump the trace in binary
+ *  F          - Write the trace as CSV to LATENCY_TRACE_FILE (Native simulator only)
+ *  R          - Clear the trace
+ *  S<0|1>     - Stop / Resume tracing
+ */
+void GcodeSuite::M161() {
+  if (parser.seen('S')) latency_trace.enabled = parser.value_bool();
+
+  if (parser.seen_test('R')) latency_trace.clear();
+
+  if (parser.seen_test('B'))
+    latency_trace.dump_binary();
+  #ifdef __PLAT_NATIVE_SIM__
+    else if (parser.seen_test('F'))
+      latency_trace.dump_file();
+  #endif
+  else if (!parser.seen("RS"))
+    latency_trace.dump_csv();
+}
+
+#endif // LATENCY_TRACE
@@ -28,6 +28,10 @@
 #include "../../queue.h"
 #include "../../parser.h"
 
+#if ENABLED(GCODE_MACRO_CACHE)
+  #include "../../macro_cache.h"
+#endif
+
 char gcode_macros[GCODE_MACROS_SLOTS][GCODE_MACROS_SLOT_SIZE + 1] = {{ 0 }};
 
 /**
@@ -48,6 +52,7 @@ void GcodeSuite::M810_819() {
     if (len > GCODE_MACROS_SLOT_SIZE)
       SERIAL_ERROR_MSG("Macro too long.");
     else {
+      TERN_(GCODE_MACRO_CACHE, macroCache.forget(gcode_macros[index])); // Pre-parse again on the next run
       char c, *s = parser.string_arg, *d = gcode_macros[index];
       do {
         c = *s++;
@@ -58,7 +63,7 @@ void GcodeSuite::M810_819() {
   else {
     // Execute a macro
     char * const cmd = gcode_macros[index];
-    if (strlen(cmd)) process_subcommands_now(cmd);
+    if (strlen(cmd) && !TERN0(GCODE_MACRO_CACHE, macroCache.run(cmd))) process_subcommands_now(cmd);
   }
 }
 
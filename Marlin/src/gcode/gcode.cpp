@@ -36,6 +36,10 @@ GcodeSuite gcode;
 #include "queue.h"
 #include "../module/motion.h"
 
+#if ENABLED(GCODE_MACRO_CACHE)
+  #include "macro_cache.h"
+#endif
+
 #if ENABLED(PRINTCOUNTER)
   #include "../module/printcounter.h"
 #endif
@@ -69,6 +73,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(LATENCY_TRACE)
+  #include "../feature/latency_trace.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -313,6 +321,8 @@ void GcodeSuite::dwell(millis_t time) {
  * Process the parsed command and dispatch it to its handler
  */
 void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
+  TERN_(LATENCY_TRACE, const LatencyTrace::Span trace_span(LatencyTrace::COMMAND, parser.command_letter, parser.codenum));
+
   TERN_(HAS_FANCHECK, fan_check.check_deferred_error());
 
   KEEPALIVE_STATE(IN_HANDLER);
@@ -637,6 +647,18 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 155: M155(); break;                                  // M155: Set temperature auto-report interval
       #endif
 
+      #if ENABLED(STEPPER_ISR_PROFILER)
+        case 159: M159(); break;                                  // M159: Report Stepper ISR timing
+      #endif
+
+      #if ENABLED(IDLE_TASK_SCHEDULER)
+        case 160: M160(); break;                                  // M160: Report idle task timing
+      #endif
+
+      #if ENABLED(LATENCY_TRACE)
+        case 161: M161(); break;                                  // M161: Dump the latency trace
+      #endif
+
       #if ENABLED(PARK_HEAD_ON_PAUSE)
         case 125: M125(); break;                                  // M125: Store current position and move to filament change position
       #endif
@@ -1156,6 +1178,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
 
   if (!no_ok) queue.ok_to_send();
 
+  // Subcommands return with their arc fully queued
+  TERN_(ARC_STREAMING, if (no_ok) finish_arc());
+
   SERIAL_IMPL.msgDone(); // Call the msgDone serial hook to signal command processing done
 }
 
@@ -1176,7 +1201,8 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    parser.echo_command(command.buffer);
+    SERIAL_EOL();
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(F("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -1198,6 +1224,7 @@ void GcodeSuite::process_next_command() {
  * G-code "macros" to be called from within other G-code handlers.
  */
 void GcodeSuite::process_subcommands_now(FSTR_P fgcode) {
+  if (TERN0(GCODE_MACRO_CACHE, macroCache.run(fgcode))) return; // Run pre-parsed commands, if cached
   PGM_P pgcode = FTOP(fgcode);
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
   for (;;) {
@@ -175,6 +175,9 @@
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M159 - Report Stepper ISR timing. R to reset, S<seconds> to auto-report. (Requires STEPPER_ISR_PROFILER)
+ * M160 - Report idle task timing. R to reset. (Requires IDLE_TASK_SCHEDULER)
+ * M161 - Dump the main loop latency trace. B binary, F to file, R to clear, S<0|1> to stop/resume. (Requires LATENCY_TRACE)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -490,11 +493,18 @@ public:
 
   static void dwell(millis_t time);
 
+  #if ENABLED(ARC_STREAMING)
+    static bool arc_pending();    // An arc has segments left to queue
+    static void arc_task();       // Queue arc segments while the planner has room. Called from the command queue.
+    static void finish_arc();     // Queue the rest of the arc, waiting for the planner
+    static void cancel_arc();     // Drop the rest of the arc
+  #endif
+
 private:
 
   friend class MarlinSettings;
   #if ENABLED(ARC_SUPPORT)
-    friend void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t);
+    friend void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t, const bool);
   #endif
 
   #if ENABLED(MARLIN_DEV_MODE)
@@ -850,6 +860,18 @@ private:
     static void M155();
   #endif
 
+  #if ENABLED(STEPPER_ISR_PROFILER)
+    static void M159();
+  #endif
+
+  #if ENABLED(IDLE_TASK_SCHEDULER)
+    static void M160();
+  #endif
+
+  #if ENABLED(LATENCY_TRACE)
+    static void M161();
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     static void M163();
     static void M164();
@@ -0,0 +1,203 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(GCODE_MACRO_CACHE)
+
+#include "macro_cache.h"
+#include "gcode.h"
+#include "parser.h"
+
+MacroCache macroCache;
+
+uint8_t MacroCache::store[GCODE_MACRO_CACHE_SIZE];
+uint16_t MacroCache::used; // = 0
+MacroCache::entry_t MacroCache::entries[GCODE_MACRO_CACHE_SCRIPTS];
+uint8_t MacroCache::count, // = 0
+        MacroCache::depth; // = 0
+
+/**
+ * Run a script from its pre-parsed records, like GcodeSuite::process_subcommands_now.
+ * Each record is copied out before it's run, so handlers can't disturb the store.
+ */
+bool MacroCache::run(const char * const script, const bool pgm) {
+  char * const saved_cmd = parser.command_ptr;        // Save the parser state
+
+  entry_t *e = nullptr;
+  for (uint8_t i = 0; i < count; ++i)
+    if (entries[i].script == script && entries[i].pgm == pgm) { e = &entries[i]; break; }
+
+  if (!e) {
+    e = add(script, pgm);
+    if (e) parser.parse(saved_cmd);                   // Pre-parsing used the parser
+  }
+  if (!e || !e->length) return false;
+
+  // The store only moves while no script is running
+  const uint16_t start = e->offset, end = start + e->length;
+
+  ++depth;
+  for (uint16_t i = start; i < end;) {
+    const uint8_t len = store[i++];
+    char cmd[MAX_CMD_SIZE];
+    memcpy(cmd, &store[i], len);
+    i += len;
+    parser.parse(cmd);                                // Parse the command
+    gcode.process_parsed_command(true);               // Process it (no "ok")
+  }
+  --depth;
+
+  parser.parse(saved_cmd);                            // Restore the parser state
+  return true;
+}
+
+void MacroCache::forget(const char * const script) {
+  for (uint8_t i = 0; i < count; ++i)
+    if (entries[i].script == script && !entries[i].pgm) entries[i].script = nullptr;
+}
+
+/**
+ * Add a script and pre-parse it into the store.
+ * A script that doesn't fit gets an empty entry, so it isn't parsed again.
+ * Return nullptr if there are no free entries.
+ */
+MacroCache::entry_t* MacroCache::add(const char * const script, const bool pgm) {
+  if (!depth) compact();
+  if (count >= GCODE_MACRO_CACHE_SCRIPTS) return nullptr;
+
+  entry_t &e = entries[count++];
+  e.script = script;
+  e.pgm = pgm;
+  e.offset = used;
+  e.length = 0;
+
+  uint16_t pos = used;
+  for (const char *s = script;;) {
+    const char * const delim = pgm ? strchr_P(s, '\n') : strchr(s, '\n');
+    const size_t len = delim ? delim - s : (pgm ? strlen_P(s) : strlen(s));
+    if (len >= MAX_CMD_SIZE) return &e;
+
+    char line[MAX_CMD_SIZE];
+    if (pgm) memcpy_P(line, s, len); else memcpy(line, s, len);
+    line[len] = '\0';
+
+    const uint8_t rlen = pos < sizeof(store) ? compile_line(line, &store[pos + 1], _MIN(sizeof(store) - pos - 1, 255U)) : 0;
+    if (!rlen) return &e;                             // The store is full
+    store[pos] = rlen;
+    pos += 1 + rlen;
+
+    if (!delim) break;
+    s = delim + 1;
+  }
+
+  e.length = pos - e.offset;
+  used = pos;
+  return &e;
+}
+
+/**
+ * Write one command line as a pre-parsed record if possible, or as text.
+ * Commands with string arguments, and values that a float can't hold
+ * exactly as an integer, stay as text. Return the record length, or 0
+ * if it doesn't fit in the given room.
+ */
+uint8_t MacroCache::compile_line(char * const line, uint8_t * const out, const uint8_t room) {
+  const char *p = line;
+  while (*p == ' ') ++p;
+  char letter = *p;
+  if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(letter, 'a', 'z'))) letter += 'A' - 'a';
+
+  if (letter == 'G' || letter == 'M' || letter == 'T') {
+    char cmd[MAX_CMD_SIZE];
+    strcpy(cmd, line);                                // The parser may modify the line
+
+    // Pre-parsing mustn't change the motion mode. That happens when the record runs.
+    #if ENABLED(GCODE_MOTION_MODES)
+      const int16_t saved_mode = parser.motion_mode_codenum;
+      TERN_(USE_GCODE_SUBCODES, const uint8_t saved_subcode = parser.motion_mode_subcode);
+    #endif
+
+    parser.parse(cmd);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      parser.motion_mode_codenum = saved_mode;
+      TERN_(USE_GCODE_SUBCODES, parser.motion_mode_subcode = saved_subcode);
+    #endif
+
+    if (parser.command_letter == letter && !parser.string_arg) {
+      uint8_t rec[MAX_CMD_SIZE - 1];
+      uint32_t codebits = 0, valuebits = 0;
+      uint8_t len = BINARY_GCODE_VALUES;
+      bool ok = true;
+      for (uint8_t i = 0; ok && i < 26; ++i) {
+        if (!parser.seen('A' + i)) continue;
+        SBI32(codebits, i);
+        if (!parser.has_value()) continue;
+        const float v = parser.value_float();
+        ok = ABS(v) < 2147483648.0f && int32_t(v) == parser.value_long() && len + sizeof(v) <= sizeof(rec);
+        if (ok) {
+          SBI32(valuebits, i);
+          memcpy(&rec[len], &v, sizeof(v));
+          len += sizeof(v);
+        }
+      }
+
+      if (ok) {
+        rec[0] = BINARY_GCODE_CMD;
+        rec[1] = letter;
+        rec[2] = uint8_t(parser.codenum);
+        rec[3] = uint8_t(parser.codenum >> 8);
+        rec[4] = TERN0(USE_GCODE_SUBCODES, parser.subcode);
+        memcpy(&rec[5], &codebits, sizeof(codebits));
+        memcpy(&rec[9], &valuebits, sizeof(valuebits));
+        if (len > room) return 0;
+        memcpy(out, rec, len);
+        return len;
+      }
+    }
+  }
+
+  // Keep the command as text, with its terminator
+  const size_t len = strlen(line) + 1;
+  if (len > room) return 0;
+  memcpy(out, line, len);
+  return len;
+}
+
+// Drop forgotten scripts and close the gaps. Only while no script is running.
+void MacroCache::compact() {
+  uint8_t n = 0;
+  uint16_t pos = 0;
+  for (uint8_t i = 0; i < count; ++i) {
+    entry_t e = entries[i];
+    if (!e.script) continue;
+    if (e.length && e.offset != pos) memmove(&store[pos], &store[e.offset], e.length);
+    e.offset = pos;
+    pos += e.length;
+    entries[n++] = e;
+  }
+  count = n;
+  used = pos;
+}
+
+#endif // GCODE_MACRO_CACHE
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * macro_cache.h - Pre-parsed G-code scripts
+ *
+ * Scripts run by GcodeSuite::process_subcommands_now and M810-M819 macros are
+ * parsed once, on first use, into a static store of records in the binary_gcode.h
+ * format. Replaying a script hands each record to the parser with no text scan
+ * and no number conversion. Commands that can't be pre-parsed are kept as text.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class MacroCache {
+  public:
+    // Run a cached script, pre-parsing it first if needed.
+    // Return false if the script couldn't be cached, so the caller runs it as text.
+    static bool run(FSTR_P const fscript) { return run(FTOP(fscript), true); }
+    static bool run(const char * const script) { return run(script, false); }
+
+    // Drop a RAM script. Call before changing it, e.g., when a macro is redefined.
+    static void forget(const char * const script);
+
+  private:
+    typedef struct {
+      const char *script;   // Script address, used as the key
+      bool pgm;             // The script is in PROGMEM
+      uint16_t offset,      // Records in the store
+               length;      // Length of the records, 0 if they didn't fit
+    } entry_t;
+
+    static uint8_t store[GCODE_MACRO_CACHE_SIZE];
+    static uint16_t used;
+    static entry_t entries[GCODE_MACRO_CACHE_SCRIPTS];
+    static uint8_t count;
+    static uint8_t depth;   // Nesting level of running scripts
+
+    static bool run(const char * const script, const bool pgm);
+    static entry_t* add(const char * const script, const bool pgm);
+    static uint8_t compile_line(char * const line, uint8_t * const out, const uint8_t room);
+    static void compact();
+};
+
+extern MacroCache macroCache;
@@ -51,6 +51,163 @@
 #define ARC_LIJKUVW_CODE(L,I,J,K,U,V,W)    CODE_N(SUB2(NUM_AXES),L,I,J,K,U,V,W)
 #define ARC_LIJKUVWE_CODE(L,I,J,K,U,V,W,E) ARC_LIJKUVW_CODE(L,I,J,K,U,V,W); CODE_ITEM_E(E)
 
+/**
+ * The arc being traced. plan_arc sets it up and the segments are queued one at a time,
+ * all at once or, with ARC_STREAMING, from the command queue as the planner frees up.
+ */
+static struct {
+  AxisEnum axis_p, axis_q;        // The two axes of the arc plane
+  xyze_pos_t cart,                // Destination position
+             start;               // Starting position
+  xyze_float_t per_segment;       // Linear travel per segment on the non-arc axes
+  ab_float_t offset,              // Center of rotation relative to the starting position
+             rvec;                // Radius vector from the center to the last segment
+  float center_P, center_Q, radius,
+        flat_mm, segment_mm,
+        theta_per_segment, sin_T, cos_T,
+        limiting_accel, limiting_speed_sqr;
+  feedRate_t fr_mm_s;
+  PlannerHints hints;
+  uint16_t segments,              // Segments in the arc
+           index;                 // Next segment to queue. 0 if there's no arc.
+  #if N_ARC_CORRECTION > 1
+    int8_t recalc_count;          // Segments until the next correction
+  #endif
+  #if ENABLED(ARC_STREAMING)
+    ab_float_t next_rvec;         // Exact radius vector computed ahead for a correction
+    uint16_t next_index;          // Segment of next_rvec. 0 if none.
+    bool busy;                    // Segments are being queued
+  #endif
+} arc;
+
+// Exact radius vector at segment i, by applying the transformation matrix to the initial radius vector (=-offset)
+static ab_float_t arc_rvec(const uint16_t i) {
+  const float Ti = i * arc.theta_per_segment, cos_Ti = cos(Ti), sin_Ti = sin(Ti);
+  return { -arc.offset.a * cos_Ti + arc.offset.b * sin_Ti, -arc.offset.a * sin_Ti - arc.offset.b * cos_Ti };
+}
+
+/**
+ * Queue the next segment of the arc, ending with the exact destination.
+ * Return false once the last segment is queued.
+ */
+static bool queue_arc_segment() {
+  const uint16_t i = arc.index;
+  xyze_pos_t raw;
+
+  if (i < arc.segments) {
+    #if N_ARC_CORRECTION > 1
+      if (--arc.recalc_count) {
+        // Apply vector rotation matrix to previous rvec.a / 1
+        const float r_new_Y = arc.rvec.a * arc.sin_T + arc.rvec.b * arc.cos_T;
+        arc.rvec.a = arc.rvec.a * arc.cos_T - arc.rvec.b * arc.sin_T;
+        arc.rvec.b = r_new_Y;
+      }
+      else
+    #endif
+    {
+      #if N_ARC_CORRECTION > 1
+        arc.recalc_count = N_ARC_CORRECTION;
+      #endif
+
+      // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+      #if ENABLED(ARC_STREAMING)
+        if (arc.next_index == i)
+          arc.rvec = arc.next_rvec;   // Computed ahead while the planner was full
+        else
+      #endif
+          arc.rvec = arc_rvec(i);
+    }
+
+    // Update raw location
+    raw = arc.start + arc.per_segment * float(i);
+    raw[arc.axis_p] = arc.center_P + arc.rvec.a;
+    raw[arc.axis_q] = arc.center_Q + arc.rvec.b;
+
+    // calculate safe speed for stopping by the end of the arc
+    const float arc_mm_remaining = arc.flat_mm - arc.segment_mm * i;
+    arc.hints.safe_exit_speed_sqr = _MIN(arc.limiting_speed_sqr, 2 * arc.limiting_accel * arc_mm_remaining);
+  }
+  else {
+    // Ensure last segment arrives at target location.
+    raw = arc.cart;
+    arc.hints.curve_radius = 0;
+    arc.hints.safe_exit_speed_sqr = 0.0f;
+  }
+
+  apply_motion_limits(raw);
+
+  #if HAS_LEVELING && !PLANNER_LEVELING
+    planner.apply_leveling(raw);
+  #endif
+
+  const bool ok = planner.buffer_line(raw, arc.fr_mm_s, active_extruder, arc.hints);
+
+  if (!arc.index) return false;                 // Canceled while waiting for the planner
+
+  if (i >= arc.segments) {
+    current_position = arc.cart;
+    arc.index = 0;
+    return false;
+  }
+
+  arc.hints.curve_radius = arc.radius;
+  arc.index = ok ? i + 1 : arc.segments;        // Skip to the last segment on failure
+  return true;
+}
+
+// Queue all the remaining segments of the arc, waiting for the planner as needed
+static void finish_arc_segments() {
+  TERN_(ARC_STREAMING, arc.busy = true);
+  millis_t next_idle_ms = millis() + 200UL;
+  while (arc.index) {
+    thermalManager.task();
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_idle_ms)) {
+      next_idle_ms = ms + 200UL;
+      idle();
+    }
+    queue_arc_segment();
+  }
+  TERN_(ARC_STREAMING, arc.busy = false);
+}
+
+#if ENABLED(ARC_STREAMING)
+
+  bool GcodeSuite::arc_pending() { return arc.index; }
+
+  void GcodeSuite::finish_arc() { if (!arc.busy) finish_arc_segments(); }
+
+  void GcodeSuite::cancel_arc() { arc.index = 0; }
+
+  /**
+   * Queue arc segments while the planner has free blocks. Called from the command queue,
+   * so segments can't interleave with moves made from idle().
+   * While the planner is full, compute the next arc correction ahead of time
+   * so its sin() and cos() don't delay the segment that needs it.
+   */
+  void GcodeSuite::arc_task() {
+    if (!arc.index || arc.busy) return;
+    arc.busy = true;
+
+    while (arc.index && planner.moves_free()) queue_arc_segment();
+
+    if (WITHIN(arc.index, 1, arc.segments - 1)) {
+      #if N_ARC_CORRECTION > 1
+        const uint16_t n = arc.index + arc.recalc_count - 1;
+      #else
+        const uint16_t n = arc.index;
+      #endif
+      if (n < arc.segments && n != arc.next_index) {
+        arc.next_rvec = arc_rvec(n);
+        arc.next_index = n;
+      }
+    }
+
+    arc.busy = false;
+  }
+
+#endif // ARC_STREAMING
+
 /**
  * Plan an arc in 2 dimensions, with linear motion in the other axes.
  * The arc is traced with many small linear segments according to the configuration.
@@ -59,8 +216,12 @@ void plan_arc(
   const xyze_pos_t &cart,   // Destination position
   const ab_float_t &offset, // Center of rotation relative to current_position
   const bool clockwise,     // Clockwise?
-  const uint8_t circles     // Take the scenic route
+  const uint8_t circles,    // Take the scenic route
+  const bool stream         // Leave the segments for the command queue (ARC_STREAMING)
 ) {
+  // Finish any arc still being queued
+  TERN_(ARC_STREAMING, gcode.finish_arc());
+
   #if ENABLED(CNC_WORKSPACE_PLANES)
     AxisEnum axis_p, axis_q, axis_l;
     switch (gcode.workspace_plane) {
@@ -168,7 +329,7 @@ void plan_arc(
         temp_position.w       += per_circle_W,
         temp_position.e       += per_circle_E                   // Destination E axis
       );
-      plan_arc(temp_position, offset, clockwise, 0);            // Plan a single whole circle
+      plan_arc(temp_position, offset, clockwise, 0, false);     // Plan a single whole circle
     }
 
     // Get starting coordinates for the remainder from the current position
@@ -220,29 +381,104 @@ void plan_arc(
   // Feedrate for the move, scaled by the feedrate multiplier
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Get the ideal segment length for the move based on settings
-  const float ideal_segment_mm = (
-    #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
-      constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
-    #else
-      MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
-    #endif
-  );
+  #if ENABLED(FTM_CURVES)
+    // With Fixed-Time Motion each part of the arc, up to 45°, can be a single curve block
+    if (planner.can_buffer_curves()) {
+      const uint16_t parts = CEIL(abs_angular_travel / RADIANS(45));
+      const float theta_per_part = angular_travel / parts,
+                  k = (4.0f / 3.0f) * tan(0.25f * theta_per_part); // Bézier control point distance per mm of radius
+
+      PlannerHints hints;
+      xyze_pos_t start = current_position;
+      ab_float_t r0 = rvec;
+      for (uint16_t i = 1; i <= parts; ++i) {
+        xyze_pos_t end;
+        ab_float_t r1;
+        if (i < parts) {
+          const float Ti = i * theta_per_part, cos_Ti = cos(Ti), sin_Ti = sin(Ti);
+          r1.set(-offset[0] * cos_Ti + offset[1] * sin_Ti, -offset[0] * sin_Ti - offset[1] * cos_Ti);
+          end = current_position + (cart - current_position) * (float(i) / parts);
+          end[axis_p] = center_P + r1.a;
+          end[axis_q] = center_Q + r1.b;
+        }
+        else {
+          end = cart;
+          r1.set(cart[axis_p] - center_P, cart[axis_q] - center_Q);
+        }
+
+        apply_motion_limits(end);
+
+        // Control points along the tangents at both ends
+        const xy_float_t c1 = { -r0.b * k, r0.a * k },
+                         c2 = { r1.a - r0.a + r1.b * k, r1.b - r0.b - r1.a * k };
+
+        if (!planner.buffer_curve(start, end, c1, c2, axis_p, axis_q, scaled_fr_mm_s, active_extruder, hints)) {
+          // Fall back to chords no longer than MAX_ARC_SEGMENT_MM for this part
+          const uint16_t chords = _MAX(1, CEIL(radius * ABS(theta_per_part) / (MAX_ARC_SEGMENT_MM)));
+          const float theta_per_chord = theta_per_part / chords,
+                      cos_T = cos(theta_per_chord), sin_T = sin(theta_per_chord);
+          ab_float_t rc = r0;
+          for (uint16_t j = 1; j < chords; ++j) {
+            rc.set(rc.a * cos_T - rc.b * sin_T, rc.a * sin_T + rc.b * cos_T);
+            xyze_pos_t chord_end = start + (end - start) * (float(j) / chords);
+            chord_end[axis_p] = center_P + rc.a;
+            chord_end[axis_q] = center_Q + rc.b;
+            apply_motion_limits(chord_end);
+            planner.buffer_line(chord_end, scaled_fr_mm_s, active_extruder, hints);
+            hints.curve_radius = radius;
+          }
+          planner.buffer_line(end, scaled_fr_mm_s, active_extruder, hints);
+        }
+
+        hints.curve_radius = radius;
+        start = end;
+        r0 = r1;
+      }
+
+      current_position = cart;
+      return;
+    }
+  #endif
+
+  #ifdef ARC_CHORD_TOLERANCE
 
-  // Number of whole segments based on the ideal segment length
-  const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
-              nominal_segment_mm = flat_mm / nominal_segments;
+    // The longest chord that strays no more than ARC_CHORD_TOLERANCE from the arc,
+    // but no shorter than MIN_ARC_SEGMENT_MM
+    const float ideal_segment_mm = radius > (ARC_CHORD_TOLERANCE)
+      ? _MAX(2 * SQRT((ARC_CHORD_TOLERANCE) * (2 * radius - (ARC_CHORD_TOLERANCE))), MIN_ARC_SEGMENT_MM)
+      : 2 * radius;
+
+    // The number of whole segments in the arc, no longer than the ideal segment length
+    const uint16_t segments = _MAX(CEIL(flat_mm / ideal_segment_mm), min_segments);
+
+  #else
+
+    // Get the ideal segment length for the move based on settings
+    const float ideal_segment_mm = (
+      #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
+        constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+      #else
+        MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
+      #endif
+    );
+
+    // Number of whole segments based on the ideal segment length
+    const float nominal_segments = _MAX(FLOOR(flat_mm / ideal_segment_mm), min_segments),
+                nominal_segment_mm = flat_mm / nominal_segments;
+
+    // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
+    const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
+                              nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
+                              nominal_segments;
+
+  #endif
 
-  // The number of whole segments in the arc, with best attempt to honor MIN_ARC_SEGMENT_MM and MAX_ARC_SEGMENT_MM
-  const uint16_t segments = nominal_segment_mm > (MAX_ARC_SEGMENT_MM) ? CEIL(flat_mm / (MAX_ARC_SEGMENT_MM)) :
-                            nominal_segment_mm < (MIN_ARC_SEGMENT_MM) ? _MAX(1, FLOOR(flat_mm / (MIN_ARC_SEGMENT_MM))) :
-                            nominal_segments;
   const float segment_mm = flat_mm / segments;
 
   // Add hints to help optimize the move
-  PlannerHints hints;
+  arc.hints = PlannerHints();
   #if ENABLED(FEEDRATE_SCALING)
-    hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
+    arc.hints.inv_duration = (scaled_fr_mm_s / flat_mm) * segments;
   #endif
 
   /**
@@ -272,132 +508,60 @@ void plan_arc(
    * This is important when there are successive arc motions.
    */
 
-  xyze_pos_t raw;
+  arc.axis_p = axis_p;
+  arc.axis_q = axis_q;
+  arc.cart = cart;
+  arc.start = current_position;
+  arc.offset = offset;
+  arc.rvec = rvec;
+  arc.center_P = center_P;
+  arc.center_Q = center_Q;
+  arc.radius = radius;
+  arc.flat_mm = flat_mm;
+  arc.segment_mm = segment_mm;
+  arc.fr_mm_s = scaled_fr_mm_s;
+  arc.segments = segments;
 
   // Don't calculate rotation parameters for trivial single-segment arcs
   if (segments > 1) {
     // Vector rotation matrix values
-    const float theta_per_segment = angular_travel / segments,
-                sq_theta_per_segment = sq(theta_per_segment),
-                sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
-                cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
-
-    ARC_LIJKUVWE_CODE(
-      const float per_segment_L = travel_L / segments,
-      const float per_segment_I = travel_I / segments,
-      const float per_segment_J = travel_J / segments,
-      const float per_segment_K = travel_K / segments,
-      const float per_segment_U = travel_U / segments,
-      const float per_segment_V = travel_V / segments,
-      const float per_segment_W = travel_W / segments,
-      const float per_segment_E = travel_E / segments
-    );
-
-    // Initialize all linear axes and E
-    ARC_LIJKUVWE_CODE(
-      raw[axis_l] = start_L,
-      raw.i       = start_I,
-      raw.j       = start_J,
-      raw.k       = start_K,
-      raw.u       = start_U,
-      raw.v       = start_V,
-      raw.w       = start_W,
-      raw.e       = start_E
-    );
+    arc.theta_per_segment = angular_travel / segments;
+    const float sq_theta_per_segment = sq(arc.theta_per_segment);
+    arc.sin_T = arc.theta_per_segment - sq_theta_per_segment * arc.theta_per_segment / 6;
+    arc.cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
 
-    millis_t next_idle_ms = millis() + 200UL;
+    // Linear travel per segment. The arc axes are replaced by the rotated radius vector.
+    arc.per_segment = (cart - arc.start) / float(segments);
 
     #if N_ARC_CORRECTION > 1
-      int8_t arc_recalc_count = N_ARC_CORRECTION;
+      arc.recalc_count = N_ARC_CORRECTION;
     #endif
+    TERN_(ARC_STREAMING, arc.next_index = 0);
 
     // An arc can always complete within limits from a speed which...
     // a) is <= any configured maximum speed,
     // b) does not require centripetal force greater than any configured maximum acceleration,
     // c) is <= nominal speed,
     // d) allows the print head to stop in the remining length of the curve within all configured maximum accelerations.
-    // The last has to be calculated every time through the loop.
-    const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]),
-                limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
-                limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
-
-    for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
-
-      thermalManager.task();
-      const millis_t ms = millis();
-      if (ELAPSED(ms, next_idle_ms)) {
-        next_idle_ms = ms + 200UL;
-        idle();
-      }
-
-      #if N_ARC_CORRECTION > 1
-        if (--arc_recalc_count) {
-          // Apply vector rotation matrix to previous rvec.a / 1
-          const float r_new_Y = rvec.a * sin_T + rvec.b * cos_T;
-          rvec.a = rvec.a * cos_T - rvec.b * sin_T;
-          rvec.b = r_new_Y;
-        }
-        else
-      #endif
-      {
-        #if N_ARC_CORRECTION > 1
-          arc_recalc_count = N_ARC_CORRECTION;
-        #endif
-
-        // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
-        // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
-        // To reduce stuttering, the sin and cos could be computed at different times.
-        // For now, compute both at the same time.
-        const float Ti = i * theta_per_segment, cos_Ti = cos(Ti), sin_Ti = sin(Ti);
-        rvec.a = -offset[0] * cos_Ti + offset[1] * sin_Ti;
-        rvec.b = -offset[0] * sin_Ti - offset[1] * cos_Ti;
-      }
-
-      // Update raw location
-      raw[axis_p] = center_P + rvec.a;
-      raw[axis_q] = center_Q + rvec.b;
-      ARC_LIJKUVWE_CODE(
-        raw[axis_l] = start_L + per_segment_L * i,
-        raw.i       = start_I + per_segment_I * i,
-        raw.j       = start_J + per_segment_J * i,
-        raw.k       = start_K + per_segment_K * i,
-        raw.u       = start_U + per_segment_U * i,
-        raw.v       = start_V + per_segment_V * i,
-        raw.w       = start_W + per_segment_W * i,
-        raw.e       = start_E + per_segment_E * i
-      );
-
-      apply_motion_limits(raw);
-
-      #if HAS_LEVELING && !PLANNER_LEVELING
-        planner.apply_leveling(raw);
-      #endif
-
-      // calculate safe speed for stopping by the end of the arc
-      const float arc_mm_remaining = flat_mm - segment_mm * i;
-      hints.safe_exit_speed_sqr = _MIN(limiting_speed_sqr, 2 * limiting_accel * arc_mm_remaining);
-
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-
-      hints.curve_radius = radius;
-    }
+    // The last has to be calculated for every segment.
+    const float limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]);
+    arc.limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]);
+    arc.limiting_speed_sqr = _MIN(sq(limiting_speed), arc.limiting_accel * radius, sq(scaled_fr_mm_s));
   }
 
-  // Ensure last segment arrives at target location.
-  raw = cart;
-
-  apply_motion_limits(raw);
+  arc.index = 1;
 
-  #if HAS_LEVELING && !PLANNER_LEVELING
-    planner.apply_leveling(raw);
+  // Queue the segments now, or leave them for the command queue as the planner frees up
+  #if ENABLED(ARC_STREAMING)
+    if (stream) {
+      gcode.arc_task();
+      current_position = cart;  // The position after the arc, for anything that reads it meanwhile
+      return;
+    }
+  #else
+    UNUSED(stream);
   #endif
-
-  hints.curve_radius = 0;
-  hints.safe_exit_speed_sqr = 0.0f;
-  planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
-
-  current_position = cart;
+  finish_arc_segments();
 
 } // plan_arc
 
@@ -486,7 +650,7 @@ void GcodeSuite::G2_G3(const bool clockwise) {
     #endif
 
     // Send the arc to the planner
-    plan_arc(destination, arc_offset, clockwise, circles_to_do);
+    plan_arc(destination, arc_offset, clockwise, circles_to_do, true);
     reset_stepper_timeout();
   }
   else
@@ -28,6 +28,9 @@
 
 #include "../gcode.h"
 #include "../../module/planner.h"
+#if ENABLED(DIRECT_STEPPING_STREAM)
+  #include "../../module/motion.h"
+#endif
 
 /**
  * G6: Direct Stepper Move
@@ -58,7 +61,19 @@ void GcodeSuite::G6() {
   uint16_t num_steps = DirectStepping::Config::TOTAL_STEPS;
   if (parser.seen('S')) num_steps = parser.value_ushort();
 
-  planner.buffer_page(page_idx, 0, num_steps);
+  planner.buffer_page(page_idx, active_extruder, num_steps);
+
+  #if ENABLED(DIRECT_STEPPING_STREAM)
+    // Moves after the page start where it ends
+    xyze_pos_t pos = current_position;
+    pos.x = planner.position.x * planner.mm_per_step[X_AXIS];
+    pos.y = planner.position.y * planner.mm_per_step[Y_AXIS];
+    pos.z = planner.position.z * planner.mm_per_step[Z_AXIS];
+    TERN_(HAS_EXTRUDERS, pos.e = planner.position.e * planner.mm_per_step[E_AXIS_N(active_extruder)]);
+    TERN_(HAS_POSITION_MODIFIERS, planner.unapply_modifiers(pos, true));
+    current_position = pos;
+  #endif
+
   reset_stepper_timeout();
 }
 
@@ -62,6 +62,9 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if HAS_PREPARSED_GCODE
+    bool GCodeParser::binary_values;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -83,6 +86,7 @@ void GCodeParser::reset() {
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
+    TERN_(HAS_PREPARSED_GCODE, binary_values = false); // Text values
   #endif
 }
 
@@ -112,6 +116,10 @@ void GCodeParser::reset() {
  */
 void GCodeParser::parse(char *p) {
 
+  #if HAS_PREPARSED_GCODE
+    if (*p == BINARY_GCODE_CMD) return parse_binary(p);
+  #endif
+
   reset(); // No codes to report
 
   auto uppercase = [](char c) {
@@ -369,6 +377,43 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if HAS_PREPARSED_GCODE
+
+  /**
+   * Populate the command line state from a pre-tokenized command (see binary_gcode.h).
+   * The parameter offsets point at the float32 values, so seen/value work as usual.
+   */
+  void GCodeParser::parse_binary(char * const p) {
+    reset();
+    command_ptr = p;
+    binary_values = true;
+    command_letter = p[1];
+    codenum = uint8_t(p[2]) | (uint16_t(uint8_t(p[3])) << 8);
+    TERN_(USE_GCODE_SUBCODES, subcode = p[4]);
+
+    uint32_t valuebits;
+    memcpy(&codebits, &p[5], sizeof(codebits));
+    memcpy(&valuebits, &p[9], sizeof(valuebits));
+
+    uint8_t offset = BINARY_GCODE_VALUES;
+    for (uint8_t i = 0; i < COUNT(param); ++i) {
+      if (!TEST32(codebits, i)) continue;
+      if (TEST32(valuebits, i)) { param[i] = offset; offset += sizeof(float); }
+      else param[i] = 0;
+    }
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+  }
+
+#endif
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
@@ -390,7 +435,37 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
-  SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+  echo_command(command_ptr);
+  SERIAL_ECHOLNPGM("\"");
+}
+
+void GCodeParser::echo_command(const char * const p) {
+  #if HAS_PREPARSED_GCODE
+    if (*p == BINARY_GCODE_CMD) {
+      SERIAL_CHAR(p[1]);
+      SERIAL_ECHO(uint16_t(uint8_t(p[2]) | (uint16_t(uint8_t(p[3])) << 8)));
+      if (p[4]) { SERIAL_CHAR('.'); SERIAL_ECHO(uint8_t(p[4])); }
+
+      uint32_t bits, valuebits;
+      memcpy(&bits, &p[5], sizeof(bits));
+      memcpy(&valuebits, &p[9], sizeof(valuebits));
+      const char *v = p + BINARY_GCODE_VALUES;
+      for (uint8_t i = 0; i < COUNT(param); ++i) {
+        if (!TEST32(bits, i)) continue;
+        SERIAL_CHAR(' ', char('A' + i));
+        if (TEST32(valuebits, i)) {
+          float f;
+          memcpy(&f, v, sizeof(f));
+          v += sizeof(f);
+          SERIAL_ECHO(p_float_t(f, 5));
+        }
+      }
+      return;
+    }
+  #endif
+  SERIAL_ECHO(p);
 }
 
 #if ENABLED(DEBUG_GCODE_PARSER)
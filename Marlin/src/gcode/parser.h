@@ -34,6 +34,10 @@
   #include "../libs/hex_print.h"
 #endif
 
+#if HAS_PREPARSED_GCODE
+  #include "binary_gcode.h"
+#endif
+
 #if ENABLED(TEMPERATURE_UNITS_SUPPORT)
   typedef enum : uint8_t { TEMPUNIT_C, TEMPUNIT_K, TEMPUNIT_F } TempUnit;
 #endif
@@ -62,6 +66,9 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if HAS_PREPARSED_GCODE
+      static bool binary_values;    // Values are float32, not text
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -149,7 +156,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(HAS_PREPARSED_GCODE, binary_values) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -237,6 +244,11 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_PREPARSED_GCODE
+    // Populate all fields from a pre-tokenized command
+    static void parse_binary(char * const p);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -257,6 +269,9 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    #if HAS_PREPARSED_GCODE
+      if (binary_values) { float f; memcpy(&f, value_ptr, sizeof(f)); return f; }
+    #endif
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
@@ -273,8 +288,14 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if HAS_PREPARSED_GCODE
+    // Binary values are clamped to the largest floats that convert without overflow
+    static int32_t value_long() { return value_ptr ? (binary_values ? int32_t(constrain(value_float(), -2147483648.0f, 2147483520.0f)) : strtol(value_ptr, nullptr, 10)) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? (binary_values ? uint32_t(constrain(value_float(), 0.0f, 4294967040.0f)) : strtoul(value_ptr, nullptr, 10)) : 0UL; }
+  #else
+    static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
@@ -417,6 +438,9 @@ public:
 
   void unknown_command_warning();
 
+  // Print a command line as queued, spelling out a pre-tokenized command
+  static void echo_command(const char * const p);
+
   // Provide simple value accessors with default option
   static char*     stringval(const char c, char * const dval=nullptr) { return seenval(c) ? value_string()   : dval; }
   static float     floatval(const char c, const float dval=0.0)   { return seenval(c) ? value_float()        : dval; }
@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "binary_gcode.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
@@ -276,7 +280,10 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
-static bool serial_data_available(serial_index_t index) {
+/**
+ * Get the number of characters waiting on the given serial port
+ */
+static int serial_data_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if ENABLED(RX_BUFFER_MONITOR) && RX_BUFFER_SIZE
     if (a > RX_BUFFER_SIZE - 2) {
@@ -284,7 +291,7 @@ static bool serial_data_available(serial_index_t index) {
       SERIAL_ERROR_MSG("RX BUF overflow, increase RX_BUFFER_SIZE: ", a);
     }
   #endif
-  return a > 0;
+  return a > 0 ? a : 0;
 }
 
 #if NO_TIMEOUTS > 0
@@ -409,6 +416,111 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+/**
+ * A line the state machine would copy as it is, with no comment,
+ * escape, quote or backspace to handle
+ */
+inline bool is_plain_line(const char *s, int len) {
+  for (; len; --len, ++s) switch (*s) {
+    case ';': case '\\': case 0x08:
+    TERN_(PAREN_COMMENTS, case '(':)
+    TERN_(GCODE_QUOTED_STRINGS, case '"':)
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Check a complete line from a serial port before it's queued. Handle the
+ * line number and checksum, and the commands that can't wait in the queue.
+ */
+GCodeQueue::SerialLineCheck GCodeQueue::check_serial_line(char * const line, const serial_index_t p) {
+  SerialState &serial = serial_state[p.index];
+
+  char* command = line;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  if (npos) {
+
+    const bool M110 = !!strstr_P(command, PSTR("M110"));
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    // The line number must be in the correct sequence.
+    if (gcode_N != serial.last_N + 1 && !M110) {
+      // A request-for-resend line was already in transit so we got two - oops!
+      if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) return LINE_SKIP;
+      // A corrupted line or too high, indicating a lost line
+      gcode_line_error(F(STR_ERR_LINE_NO), p);
+      return LINE_ERROR;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+        return LINE_ERROR;
+      }
+    }
+    else {
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return LINE_ERROR;
+    }
+
+    serial.last_N = gcode_N;
+  }
+  #if HAS_MEDIA
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
+      return LINE_ERROR;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGE(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  #if NO_TIMEOUTS > 0
+    last_command_time = millis();
+  #endif
+
+  return LINE_QUEUE;
+}
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -447,123 +559,140 @@ void GCodeQueue::get_serial_commands() {
       if (ring_buffer.full()) return;
 
       // No data for this port ? Skip it
-      if (!serial_data_available(p)) continue;
+      int avail = serial_data_available(p);
+      if (!avail) continue;
 
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
-      const int c = read_serial(p);
-      if (c < 0) {
-        // This should never happen, let's log it
-        PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-        // Crash here to get more information why it failed
-        BUG_ON("SP available but read -1");
-        SERIAL_ERROR_MSG(STR_ERR_SERIAL_MISMATCH);
-        SERIAL_FLUSH();
-        continue;
-      }
-
-      const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
-      if (ISEOL(serial_char)) {
-
-        // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
-          continue;
+      // Take the characters already received on this port a line at a time
+      while (avail > 0) {
+
+        // Copy up to the end of the line from the RX buffer into the free queue slot
+        char * const line = ring_buffer.commands[ring_buffer.index_w].buffer;
+        const int n = SERIAL_IMPL.readLine(p, line, _MIN(avail, MAX_CMD_SIZE - 1));
+        if (n <= 0) {
+          // This should never happen, let's log it
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          // Crash here to get more information why it failed
+          BUG_ON("SP available but read -1");
+          SERIAL_ERROR_MSG(STR_ERR_SERIAL_MISMATCH);
+          SERIAL_FLUSH();
+          break;
+        }
+        avail -= n;
 
-        char* command = serial.line_buffer;
+        SerialLineCheck check = LINE_SKIP;
 
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+        if (serial.count == 0 && serial.input_state == PS_NORMAL
+          && n > 1 && ISEOL(line[n - 1]) && is_plain_line(line, n - 1)
+        ) {
+          // A whole line with nothing to strip is queued right where it is
+          line[n - 1] = '\0';
+          check = check_serial_line(line, p);
+          if (check == LINE_QUEUE) ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+        }
+        else {
+          // Otherwise run the characters through the line state machine.
+          // Only the last one can end the line.
+          for (int i = 0; i < n; ++i) {
+            const char serial_char = line[i];
+            if (ISEOL(serial_char)) {
+              // Reset our state, continue if the line was empty
+              if (process_line_done(serial.input_state, serial.line_buffer, serial.count)) continue;
+
+              check = check_serial_line(serial.line_buffer, p);
+              if (check == LINE_QUEUE) ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+            }
+            else
+              process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+          }
+        }
 
-        if (npos) {
+        // The RX buffer was flushed for a resend
+        if (check == LINE_ERROR) break;
 
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
+        // Leave the rest in the RX buffer once the queue is full
+        if (ring_buffer.full()) return;
 
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
+      } // available characters
 
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
+    } // NUM_SERIAL loop
+  } // queue has space, serial has data
+}
 
-          // The line number must be in the correct sequence.
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // A request-for-resend line was already in transit so we got two - oops!
-            if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
-            // A corrupted line or too high, indicating a lost line
-            gcode_line_error(F(STR_ERR_LINE_NO), p);
-            break;
-          }
+#if HAS_MEDIA
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
+  /**
+   * Handle an SD command line that's about to be queued
+   */
+  inline void early_parse_sd_command(char * const cmd) {
+    // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
+    TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(cmd));
+
+    #if DISABLED(PARK_HEAD_ON_PAUSE)
+      // When M25 is non-blocking it can still suspend SD commands
+      // Otherwise the M125 handler needs to know SD printing is active
+      if (cmd[0] == 'M' && cmd[1] == '2' && cmd[2] == '5' && !NUMERIC(cmd[3]))
+        card.pauseSDPrint();
+    #endif
+  }
 
-          serial.last_N = gcode_N;
+  #if ENABLED(BINARY_GCODE)
+
+    /**
+     * Get records from a pre-tokenized (.GCB) file until the command buffer
+     * is full or the end of the file is reached. Each record is a complete
+     * command, so it's read straight into the next queue slot. Pre-parsed
+     * records stay binary and go to GCodeParser::parse_binary() when run.
+     */
+    inline void GCodeQueue::get_sdcard_binary_commands() {
+      // Check the file header before reading the first record
+      if (card.getIndex() == 0) {
+        char header[BINARY_GCODE_HEADER_LEN];
+        if (card.read(header, sizeof(header)) != int16_t(sizeof(header))
+          || memcmp(header, BINARY_GCODE_MAGIC, 4) || header[4] != BINARY_GCODE_VERSION
+        ) {
+          SERIAL_ERROR_MSG("Bad GCB file header");
+          card.abortFilePrintNow();
+          return;
         }
-        #if HAS_MEDIA
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command)) {
-            gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-        #endif
+      }
 
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGE(MSG_STOPPED);
-                break;
-            }
-          }
+      while (!ring_buffer.full() && !card.eof()) {
+        char * const cmd = ring_buffer.commands[ring_buffer.index_w].buffer;
+        const int16_t len = card.get();
+        bool ok = WITHIN(len, 0, MAX_CMD_SIZE - 1) && card.read(cmd, len) == len;
+        const bool is_binary = ok && len && cmd[0] == BINARY_GCODE_CMD;
+        if (ok && len)
+          ok = is_binary ? binary_gcode_valid((uint8_t*)cmd, len)
+                         : !memchr(cmd, '\0', len);     // Text records are plain lines
+        if (!ok) {
+          SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+          card.abortFilePrintNow();
+          return;
         }
 
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_MARLINUI_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
+        if (len) {
+          cmd[len] = '\0';
 
-        #if NO_TIMEOUTS > 0
-          last_command_time = ms;
-        #endif
+          // Text records may still need early handling
+          if (!is_binary) early_parse_sd_command(cmd);
 
-        // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
-      }
-      else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+          // Put the new command into the buffer (no "ok" sent)
+          ring_buffer.commit_command(true);
 
-    } // NUM_SERIAL loop
-  } // queue has space, serial has data
-}
+          // Prime Power-Loss Recovery for the NEXT commit_command
+          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+        }
 
-#if HAS_MEDIA
+        if (card.eof()) card.fileHasFinished();         // Handle end of file reached
+      }
+    }
+
+  #endif // BINARY_GCODE
 
   /**
    * Get lines from the SD Card until the command buffer is full
@@ -577,6 +706,10 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    #if ENABLED(BINARY_GCODE)
+      if (card.flag.binary_gcode) return get_sdcard_binary_commands();
+    #endif
+
     int sd_count = 0;
     int sd_error_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
@@ -609,15 +742,7 @@ void GCodeQueue::get_serial_commands() {
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
         if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
 
-          // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
-
-          #if DISABLED(PARK_HEAD_ON_PAUSE)
-            // When M25 is non-blocking it can still suspend SD commands
-            // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
-              card.pauseSDPrint();
-          #endif
+          early_parse_sd_command(command.buffer);
 
           // Put the new command into the buffer (no "ok" sent)
           ring_buffer.commit_command(true);
@@ -667,7 +792,8 @@ void GCodeQueue::execute_command(GCodeQueue::CommandLine& command) {
 
     if (DEBUGGING(ECHO)) {
         SERIAL_ECHO_START();
-        SERIAL_ECHOLN(command.buffer);
+        parser.echo_command(command.buffer);
+        SERIAL_EOL();
         #if ENABLED(M100_FREE_MEMORY_DUMPER)
             SERIAL_ECHOPGM("slot:", queue.ring_buffer.index_r);
             M100_dump_routine(F("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -708,6 +834,11 @@ void GCodeQueue::search_and_execute_command(RingBuffer& ring_buffer, const char*
  */
 void GCodeQueue::advance() {
 
+  // Queue more of a G2/G3 arc, and wait for it before the next command
+  #if ENABLED(ARC_STREAMING)
+    if (gcode.arc_pending()) { gcode.arc_task(); return; }
+  #endif
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
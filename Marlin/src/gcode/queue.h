@@ -265,8 +265,15 @@ private:
 
   static void get_serial_commands();
 
+  // Result of checking a complete serial line
+  enum SerialLineCheck : uint8_t { LINE_QUEUE, LINE_SKIP, LINE_ERROR };
+  static SerialLineCheck check_serial_line(char * const line, const serial_index_t p);
+
   #if HAS_MEDIA
     static void get_sdcard_commands();
+    #if ENABLED(BINARY_GCODE)
+      static void get_sdcard_binary_commands();
+    #endif
   #endif
 
   // Process the next "immediate" command (PROGMEM)
@@ -119,6 +119,7 @@
 
 #if !HAS_Y_AXIS
   #undef ARC_SUPPORT
+  #undef ARC_STREAMING
   #undef CALIBRATION_MEASURE_BACK
   #undef CALIBRATION_MEASURE_FRONT
   #undef CALIBRATION_MEASURE_YMAX
@@ -2607,7 +2607,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, STEPPER_ISR_PROFILER)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -3285,6 +3285,11 @@
   #define USE_GCODE_SUBCODES 1
 #endif
 
+// Pre-parsed commands for the G-code parser (binary_gcode.h)
+#if ANY(BINARY_GCODE, GCODE_MACRO_CACHE)
+  #define HAS_PREPARSED_GCODE 1
+#endif
+
 // Parking Extruder
 #if ENABLED(PARKING_EXTRUDER)
   #ifndef PARKING_EXTRUDER_GRAB_DISTANCE
@@ -3731,6 +3731,134 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "GCODE_MACROS_SLOTS must be a number from 1 to 10."
 #endif
 
+#if ENABLED(ARC_SUPPORT)
+  #ifdef ARC_CHORD_TOLERANCE
+    #if ARC_SEGMENTS_PER_SEC
+      #error "ARC_CHORD_TOLERANCE and ARC_SEGMENTS_PER_SEC cannot be used together."
+    #endif
+    static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+  #endif
+#elif ENABLED(ARC_STREAMING)
+  #error "ARC_STREAMING requires ARC_SUPPORT."
+#endif
+
+#if ENABLED(LEVELING_CORRECTION_STREAM)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+    #error "LEVELING_CORRECTION_STREAM requires AUTO_BED_LEVELING_BILINEAR or MESH_BED_LEVELING."
+  #elif !IS_KINEMATIC && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "LEVELING_CORRECTION_STREAM requires SEGMENT_LEVELED_MOVES or DELTA, SCARA, or POLAR kinematics."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "LEVELING_CORRECTION_STREAM is not compatible with SKEW_CORRECTION."
+  #endif
+#endif
+
+#if ENABLED(PROBE_SWEEP)
+  #if !HAS_BED_PROBE
+    #error "PROBE_SWEEP requires a bed probe."
+  #elif ENABLED(BD_SENSOR_PROBE_NO_STOP)
+    #error "PROBE_SWEEP is not compatible with BD_SENSOR_PROBE_NO_STOP."
+  #endif
+  static_assert(PROBE_SWEEP_BACKOFF_MIN > 0 && PROBE_SWEEP_BACKOFF_MIN <= Z_CLEARANCE_MULTI_PROBE, "PROBE_SWEEP_BACKOFF_MIN must be greater than 0 and no more than Z_CLEARANCE_MULTI_PROBE.");
+#endif
+
+#if ENABLED(JD_CORNER_BLENDING)
+  #if !HAS_JUNCTION_DEVIATION
+    #error "JD_CORNER_BLENDING requires Junction Deviation (i.e., CLASSIC_JERK disabled)."
+  #elif !WITHIN(JD_BLEND_BLOCKS, 2, 8)
+    #error "JD_BLEND_BLOCKS must be from 2 to 8."
+  #endif
+  static_assert(JD_BLEND_SEGMENT_MM > 0, "JD_BLEND_SEGMENT_MM must be greater than 0.");
+  static_assert(WITHIN(JD_BLEND_MAX_FACTOR, 1, 4), "JD_BLEND_MAX_FACTOR must be from 1 to 4.");
+#endif
+
+#if ENABLED(ABL_ADAPTIVE_GRID)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ABL_ADAPTIVE_GRID requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ANY(PROBE_MANUALLY, BD_SENSOR_PROBE_NO_STOP)
+    #error "ABL_ADAPTIVE_GRID is not compatible with PROBE_MANUALLY or BD_SENSOR_PROBE_NO_STOP."
+  #elif !WITHIN(ABL_ADAPTIVE_STRIDE, 2, 8)
+    #error "ABL_ADAPTIVE_STRIDE must be from 2 to 8."
+  #endif
+  static_assert(ABL_ADAPTIVE_TOLERANCE > 0, "ABL_ADAPTIVE_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(COMPACT_SUBDIVIDED_MESH)
+  #if DISABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "COMPACT_SUBDIVIDED_MESH requires ABL_BILINEAR_SUBDIVISION."
+  #elif ((GRID_MAX_POINTS_X) - 1) * (BILINEAR_SUBDIVISIONS) + 1 > 127 || ((GRID_MAX_POINTS_Y) - 1) * (BILINEAR_SUBDIVISIONS) + 1 > 127
+    #error "COMPACT_SUBDIVIDED_MESH allows up to 127 subdivided grid points on each axis."
+  #endif
+#endif
+
+#if ENABLED(KINEMATIC_IK_LINEARIZE)
+  #if !IS_KINEMATIC
+    #error "KINEMATIC_IK_LINEARIZE requires DELTA, SCARA, or POLAR kinematics."
+  #elif !WITHIN(KINEMATIC_IK_MAX_SPAN, 2, 64)
+    #error "KINEMATIC_IK_MAX_SPAN must be from 2 to 64."
+  #endif
+  static_assert(KINEMATIC_IK_TOLERANCE > 0, "KINEMATIC_IK_TOLERANCE must be greater than 0.");
+#endif
+
+#if ENABLED(IDLE_TASK_SCHEDULER)
+  #if !WITHIN(IDLE_TASK_LOW_WATER, 1, BLOCK_BUFFER_SIZE)
+    #error "IDLE_TASK_LOW_WATER must be from 1 to BLOCK_BUFFER_SIZE."
+  #elif !WITHIN(IDLE_TASK_MAX_DEFER, 10, 5000)
+    #error "IDLE_TASK_MAX_DEFER must be from 10 to 5000 ms."
+  #endif
+  static_assert(IDLE_TASK_BUDGET_US > 0, "IDLE_TASK_BUDGET_US must be greater than 0.");
+#endif
+
+#if ENABLED(LATENCY_TRACE)
+  static_assert(WITHIN(LATENCY_TRACE_SIZE, 16, 4096), "LATENCY_TRACE_SIZE must be from 16 to 4096.");
+#endif
+
+#if ENABLED(DIRECT_STEPPING_STREAM)
+  #if DISABLED(DIRECT_STEPPING)
+    #error "DIRECT_STEPPING_STREAM requires DIRECT_STEPPING."
+  #elif IS_KINEMATIC || ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #error "DIRECT_STEPPING_STREAM requires a Cartesian machine."
+  #elif !defined(DIRECT_STEPPING_PAGE_TIMEOUT)
+    #error "DIRECT_STEPPING_STREAM requires DIRECT_STEPPING_PAGE_TIMEOUT."
+  #endif
+#endif
+
+#if ENABLED(MPC_FEED_FORWARD)
+  #if DISABLED(MPCTEMP)
+    #error "MPC_FEED_FORWARD requires MPCTEMP."
+  #elif !HAS_EXTRUDERS
+    #error "MPC_FEED_FORWARD requires at least one extruder."
+  #endif
+  static_assert(MPC_FEED_FORWARD_TIME > 0, "MPC_FEED_FORWARD_TIME must be greater than 0.");
+#endif
+
+#if ENABLED(CONTINUOUS_ADC_SAMPLING)
+  #ifndef HAL_ADC_CONTINUOUS
+    #error "CONTINUOUS_ADC_SAMPLING is not supported on this platform."
+  #elif HAS_ADC_BUTTONS
+    #error "CONTINUOUS_ADC_SAMPLING is not compatible with ADC keypads (e.g., ZONESTAR_LCD)."
+  #elif ENABLED(FILAMENT_WIDTH_SENSOR)
+    #error "CONTINUOUS_ADC_SAMPLING is not compatible with FILAMENT_WIDTH_SENSOR."
+  #elif ANY(POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE)
+    #error "CONTINUOUS_ADC_SAMPLING is not compatible with POWER_MONITOR_CURRENT or POWER_MONITOR_VOLTAGE."
+  #endif
+#endif
+
+#if ENABLED(THERMISTOR_DENSE_TABLE)
+  #if !WITHIN(THERMISTOR_DENSE_ENTRIES, 32, 1024) || (THERMISTOR_DENSE_ENTRIES & (THERMISTOR_DENSE_ENTRIES - 1))
+    #error "THERMISTOR_DENSE_ENTRIES must be a power of 2 from 32 to 1024."
+  #endif
+#endif
+
+#if ENABLED(GCODE_MACRO_CACHE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "GCODE_MACRO_CACHE requires FASTER_GCODE_PARSER."
+  #elif !WITHIN(GCODE_MACRO_CACHE_SIZE, 64, 65535)
+    #error "GCODE_MACRO_CACHE_SIZE must be from 64 to 65535."
+  #elif !WITHIN(GCODE_MACRO_CACHE_SCRIPTS, 1, 255)
+    #error "GCODE_MACRO_CACHE_SCRIPTS must be from 1 to 255."
+  #endif
+#endif
+
 #if ENABLED(BACKLASH_COMPENSATION)
   #ifndef BACKLASH_DISTANCE_MM
     #error "BACKLASH_COMPENSATION requires BACKLASH_DISTANCE_MM."
@@ -4033,6 +4161,28 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
+/**
+ * Media read-ahead requirements
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if !HAS_MEDIA
+    #error "SD_READ_AHEAD requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
+  #elif !defined(SD_READ_AHEAD_BLOCKS) || !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 32) || !IS_POWER_OF_2(SD_READ_AHEAD_BLOCKS)
+    #error "SD_READ_AHEAD_BLOCKS must be 2, 4, 8, 16, or 32."
+  #endif
+#endif
+
+/**
+ * Binary G-code requirements
+ */
+#if ENABLED(BINARY_GCODE)
+  #if !HAS_MEDIA
+    #error "BINARY_GCODE requires SDSUPPORT or USB_FLASH_DRIVE_SUPPORT."
+  #elif DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #endif
+#endif
+
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
  */
@@ -4331,6 +4481,15 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #elif DISABLED(FTM_UNIFIED_BWS)
     #error "FT_MOTION requires FTM_UNIFIED_BWS to be enabled because FBS is not yet implemented."
   #endif
+  #if ENABLED(FTM_CURVES)
+    #if ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX, IS_KINEMATIC)
+      #error "FTM_CURVES requires a Cartesian machine."
+    #elif ENABLED(SKEW_CORRECTION)
+      #error "FTM_CURVES is not compatible with SKEW_CORRECTION."
+    #elif NONE(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
+      #error "FTM_CURVES requires ARC_SUPPORT or BEZIER_CURVE_SUPPORT."
+    #endif
+  #endif
 #endif
 
 // Multi-Stepping Limit
@@ -4353,6 +4512,52 @@ static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING
   #error "Only enable ULTIPANEL_FEEDMULTIPLY or ULTIPANEL_FLOWPERCENT, but not both."
 #endif
 
+/**
+ * Planner Benchmark requirements
+ */
+#if ENABLED(PLANNER_BENCHMARK)
+  #ifndef __PLAT_NATIVE_SIM__
+    #error "PLANNER_BENCHMARK requires the native simulator (e.g., simulator_linux_benchmark)."
+  #elif ENABLED(FT_MOTION)
+    #error "PLANNER_BENCHMARK is not compatible with FT_MOTION."
+  #endif
+#endif
+
+/**
+ * Step Compression requirements
+ */
+#if ENABLED(STEP_COMPRESSION)
+  #if ENABLED(FT_MOTION)
+    #error "STEP_COMPRESSION is not compatible with FT_MOTION."
+  #elif ENABLED(LIN_ADVANCE)
+    #error "STEP_COMPRESSION is not compatible with LIN_ADVANCE."
+  #elif ENABLED(S_CURVE_ACCELERATION)
+    #error "STEP_COMPRESSION is not compatible with S_CURVE_ACCELERATION."
+  #elif HAS_ZV_SHAPING
+    #error "STEP_COMPRESSION is not compatible with Input Shaping."
+  #elif ENABLED(NONLINEAR_EXTRUSION)
+    #error "STEP_COMPRESSION is not compatible with NONLINEAR_EXTRUSION."
+  #elif ENABLED(MIXING_EXTRUDER)
+    #error "STEP_COMPRESSION is not compatible with MIXING_EXTRUDER."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "STEP_COMPRESSION is not compatible with DIRECT_STEPPING."
+  #elif HAS_CUTTER
+    #error "STEP_COMPRESSION is not compatible with a Laser or Spindle."
+  #elif ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX)
+    #error "STEP_COMPRESSION is not yet compatible with CoreXY/XZ/YZ or Markforged kinematics."
+  #elif ENABLED(DUAL_X_CARRIAGE)
+    #error "STEP_COMPRESSION is not compatible with DUAL_X_CARRIAGE."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "STEP_COMPRESSION is not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(PLANNER_BENCHMARK)
+    #error "STEP_COMPRESSION is not compatible with PLANNER_BENCHMARK."
+  #endif
+  static_assert(WITHIN(STEP_COMPRESSION_QUEUE_SIZE, 2, 128) && IS_POWER_OF_2(STEP_COMPRESSION_QUEUE_SIZE), "STEP_COMPRESSION_QUEUE_SIZE must be 2, 4, 8, 16, 32, 64, or 128.");
+  static_assert(WITHIN(STEP_COMPRESSION_WINDOW, 3, 255), "STEP_COMPRESSION_WINDOW must be between 3 and 255.");
+  static_assert(STEP_COMPRESSION_LEAD_MS >= 4, "STEP_COMPRESSION_LEAD_MS must be at least 4.");
+  static_assert(STEP_COMPRESSION_MAX_ERROR >= 1, "STEP_COMPRESSION_MAX_ERROR must be at least 1.");
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
 #undef _NUM_AXES_STR
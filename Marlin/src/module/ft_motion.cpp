@@ -86,6 +86,11 @@ bool FTMotion::blockDataIsRunout = false;       // Indicates the last loaded blo
 xyze_pos_t   FTMotion::startPosn,                     // (mm) Start position of block
              FTMotion::endPosn_prevBlock = { 0.0f };  // (mm) End position of previous block
 xyze_float_t FTMotion::ratio;                         // (ratio) Axis move ratio of block
+#if ENABLED(FTM_CURVES)
+  block_curve_t FTMotion::curve;                      // Curve followed by a curve block
+  xy_float_t FTMotion::curve_end;                     // (mm) End of the curve, relative to startPosn
+  float FTMotion::curve_scale = 0;                    // (1/mm) Reciprocal of the curve block length
+#endif
 float FTMotion::accel_P,                        // Acceleration prime of block. [mm/sec/sec]
       FTMotion::decel_P,                        // Deceleration prime of block. [mm/sec/sec]
       FTMotion::F_P,                            // Feedrate prime of block. [mm/sec]
@@ -129,6 +134,10 @@ uint32_t FTMotion::interpIdx = 0,               // Index of current data point b
 
 constexpr uint32_t last_batchIdx = (FTM_WINDOW_SIZE) - (FTM_BATCH_SIZE);
 
+// Scratch arrays for processing runs of data points one axis at a time.
+static float batch_dist[FTM_POINTS_PER_LOOP];                   // (mm) Distance along the block of each new data point.
+static int32_t batch_steps[LOGICAL_AXES][FTM_STEPS_PER_LOOP];   // Step targets of the data points being interpolated.
+
 //-----------------------------------------------------------------
 // Function definitions.
 //-----------------------------------------------------------------
@@ -152,6 +161,7 @@ void FTMotion::runoutBlock() {
 
   startPosn = endPosn_prevBlock;
   ratio.reset();
+  TERN_(FTM_CURVES, curve_scale = 0);
 
   max_intervals = cfg.modeHasShaper() ? shaper_intervals : 0;
   if (max_intervals <= TERN(FTM_UNIFIED_BWS, FTM_BATCH_SIZE, min_max_intervals - (FTM_BATCH_SIZE)))
@@ -199,7 +209,7 @@ void FTMotion::loop() {
       else blockDataIsRunout = false;
     }
     while (!blockProcDn && !batchRdy && (makeVector_idx - makeVector_idx_z1 < (FTM_POINTS_PER_LOOP)))
-      makeVector();
+      makeVector(); // Generates as many data points as fit in the batch and this loop's budget
   }
 
   // FBS / post processing.
@@ -225,13 +235,18 @@ void FTMotion::loop() {
     batchRdy = false; // Clear so makeVector() can resume generating points.
   }
 
-  // Interpolation.
-  while (batchRdyForInterp
-    && (stepperCmdBuffItems() < (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME))
-    && (interpIdx - interpIdx_z1 < (FTM_STEPS_PER_LOOP))
-  ) {
-    convertToSteps(interpIdx);
-    if (++interpIdx == FTM_BATCH_SIZE) {
+  // Interpolation, as many data points at a time as the stepper buffer has room for.
+  while (batchRdyForInterp && (interpIdx - interpIdx_z1 < (FTM_STEPS_PER_LOOP))) {
+    const int32_t room = (FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME) - stepperCmdBuffItems();
+    if (room <= 0) break;
+    const uint32_t count = _MIN(
+      uint32_t(room - 1) / uint32_t(FTM_STEPS_PER_UNIT_TIME) + 1,
+      uint32_t(FTM_STEPS_PER_LOOP) - (interpIdx - interpIdx_z1),
+      uint32_t(FTM_BATCH_SIZE) - interpIdx
+    );
+    convertToSteps(interpIdx, count);
+    interpIdx += count;
+    if (interpIdx == FTM_BATCH_SIZE) {
       batchRdyForInterp = false;
       interpIdx = 0;
     }
@@ -435,6 +450,21 @@ void FTMotion::loop() {
     }
   }
 
+  // Apply the shaper to consecutive data points of one axis.
+  // Delayed inputs are kept in d_zi, a ring buffer indexed from zi_idx.
+  void FTMotion::AxisShaping::shape(float * const data, const uint32_t count, uint32_t zi_idx, const uint32_t max_i) {
+    for (uint32_t k = 0; k < count; k++) {
+      d_zi[zi_idx] = data[k];
+      float out = data[k] * Ai[0];
+      for (uint32_t i = 1U; i <= max_i; i++) {
+        const uint32_t udiff = zi_idx - Ni[i];
+        out += Ai[i] * d_zi[Ni[i] > zi_idx ? (FTM_ZMAX) + udiff : udiff];
+      }
+      data[k] = out;
+      if (++zi_idx == (FTM_ZMAX)) zi_idx = 0;
+    }
+  }
+
   void FTMotion::updateShapingN(const_float_t xf OPTARG(HAS_Y_AXIS, const_float_t yf), float zeta[]/*=cfg.zeta*/) {
     const float xdf = sqrt(1.0f - sq(zeta[0]));
     shaping.x.updateShapingN(xf, xdf);
@@ -517,6 +547,17 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
   ratio = moveDist * oneOverLength;
 
+  #if ENABLED(FTM_CURVES)
+    // A curve block follows its curve in the plane instead of a straight line
+    if (current_block->is_curve()) {
+      curve = current_block->curve;
+      curve_end.set(moveDist[curve.axis_p], moveDist[curve.axis_q]);
+      curve_scale = oneOverLength;
+    }
+    else
+      curve_scale = 0;
+  #endif
+
   const float spm = totalLength / current_block->step_event_count;  // (steps/mm) Distance for each step
 
   f_s = spm * current_block->initial_rate;              // (steps/s) Start feedrate
@@ -617,6 +658,13 @@ void FTMotion::loadBlockData(block_t * const current_block) {
   #endif
   if (moveDist.z > 0.f) axis_pos_move_end_ti[Z_AXIS] = move_end_ti;
   if (moveDist.z < 0.f) axis_neg_move_end_ti[Z_AXIS] = move_end_ti;
+  #if ENABLED(FTM_CURVES)
+    // A curve may move its plane axes both ways
+    if (curve_scale) {
+      axis_pos_move_end_ti[curve.axis_p] = axis_neg_move_end_ti[curve.axis_p] = move_end_ti;
+      axis_pos_move_end_ti[curve.axis_q] = axis_neg_move_end_ti[curve.axis_q] = move_end_ti;
+    }
+  #endif
   // if (moveDist.i > 0.f) axis_pos_move_end_ti[I_AXIS] = move_end_ti;
   // if (moveDist.i < 0.f) axis_neg_move_end_ti[I_AXIS] = move_end_ti;
   // if (moveDist.j > 0.f) axis_pos_move_end_ti[J_AXIS] = move_end_ti;
@@ -636,51 +684,170 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
 }
 
-// Generate data points of the trajectory.
+#if ENABLED(S_CURVE_ACCELERATION)
+
+  /**
+   * S-curve speed ramps, the same quintic Bézier as the stepper uses.
+   * A ramp from v0 to v1 over time T follows v0 + (v1 - v0) * B(u), u = t / T, with
+   *   B(u) = 10u^3 - 15u^4 + 6u^5
+   * Its mean is 1/2, as for a linear ramp, so the phase times and distances are
+   * unchanged. Acceleration starts and ends at zero, peaking at 15/8 of the linear ramp.
+   */
+
+  // Distance factor: integral of B from 0 to u
+  FORCE_INLINE float s_curve_dist(const_float_t u) { return sq(sq(u)) * (u * (u - 3.0f) + 2.5f); }
+
+  // Acceleration factor: derivative of B
+  FORCE_INLINE float s_curve_accel(const_float_t u) { return 30.0f * sq(u * (1.0f - u)); }
+
+#endif
+
+/**
+ * Generate a run of data points of the trajectory.
+ * The run ends with the block, the batch, or the points allowed for this loop,
+ * and each stage works through it one axis at a time over contiguous arrays.
+ */
 void FTMotion::makeVector() {
-  float accel_k = 0.0f;                                 // (mm/s^2) Acceleration K factor
-  float tau = (makeVector_idx + 1) * (FTM_TS);          // (s) Time since start of block
-  float dist = 0.0f;                                    // (mm) Distance traveled
+  const uint32_t idx0 = makeVector_idx,
+                 count = _MIN(
+                   (FTM_POINTS_PER_LOOP) - (makeVector_idx - makeVector_idx_z1),
+                   (FTM_WINDOW_SIZE) - makeVector_batchIdx,
+                   max_intervals - makeVector_idx
+                 ),
+                 idx_end = idx0 + count;
+  const uint32_t N12 = N1 + N2;
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    const float T1_P = N1 * (FTM_TS), T3_P = N3 * (FTM_TS),
+                T1_rcp = N1 ? 1.0f / T1_P : 0.0f, T3_rcp = N3 ? 1.0f / T3_P : 0.0f;
+  #endif
 
-  if (makeVector_idx < N1) {
+  // Distance traveled since the start of the block, one phase at a time
+  uint32_t idx = idx0, n = 0;
+  for (const uint32_t end = _MIN(idx_end, N1); idx < end; idx++, n++) {
     // Acceleration phase
-    dist = (f_s * tau) + (0.5f * accel_P * sq(tau));    // (mm) Distance traveled for acceleration phase since start of block
-    accel_k = accel_P;                                  // (mm/s^2) Acceleration K factor from Accel phase
+    const float tau = (idx + 1) * (FTM_TS);                         // (s) Time since start of block
+    #if ENABLED(S_CURVE_ACCELERATION)
+      batch_dist[n] = (f_s * tau) + accel_P * sq(T1_P) * s_curve_dist(tau * T1_rcp);
+    #else
+      batch_dist[n] = (f_s * tau) + (0.5f * accel_P * sq(tau));     // (mm) Distance traveled for acceleration phase since start of block
+    #endif
   }
-  else if (makeVector_idx < (N1 + N2)) {
+  for (const uint32_t end = _MIN(idx_end, N12); idx < end; idx++, n++) {
     // Coasting phase
-    dist = s_1e + F_P * (tau - N1 * (FTM_TS));          // (mm) Distance traveled for coasting phase since start of block
+    const float tau = (idx + 1) * (FTM_TS);
+    batch_dist[n] = s_1e + F_P * (tau - N1 * (FTM_TS));             // (mm) Distance traveled for coasting phase since start of block
   }
-  else {
+  for (; idx < idx_end; idx++, n++) {
     // Deceleration phase
-    tau -= (N1 + N2) * (FTM_TS);                        // (s) Time since start of decel phase
-    dist = s_2e + F_P * tau + 0.5f * decel_P * sq(tau); // (mm) Distance traveled for deceleration phase since start of block
-    accel_k = decel_P;                                  // (mm/s^2) Acceleration K factor from Decel phase
+    const float tau = (idx + 1) * (FTM_TS) - N12 * (FTM_TS);        // (s) Time since start of decel phase
+    #if ENABLED(S_CURVE_ACCELERATION)
+      batch_dist[n] = s_2e + F_P * tau + decel_P * sq(T3_P) * s_curve_dist(tau * T3_rcp);
+    #else
+      batch_dist[n] = s_2e + F_P * tau + 0.5f * decel_P * sq(tau);  // (mm) Distance traveled for deceleration phase since start of block
+    #endif
   }
 
-  #define _FTM_TRAJ(A) traj.A[makeVector_batchIdx] = startPosn.A + ratio.A * dist;
+  // Axis positions
+  #define _FTM_TRAJ(A) do{ \
+    float * const out = &traj.A[makeVector_batchIdx]; \
+    const float p0 = startPosn.A, r = ratio.A; \
+    for (uint32_t k = 0; k < count; k++) out[k] = p0 + r * batch_dist[k]; \
+  }while(0);
   LOGICAL_AXIS_MAP_LC(_FTM_TRAJ);
 
+  #if ENABLED(FTM_CURVES)
+    // The plane axes of a curve block follow the curve, with the same fraction of
+    // the plane length as the fraction of the block length
+    if (curve_scale) {
+      float * const out_p = &traj.data[curve.axis_p][makeVector_batchIdx],
+            * const out_q = &traj.data[curve.axis_q][makeVector_batchIdx];
+      const float p0 = startPosn[curve.axis_p], q0 = startPosn[curve.axis_q];
+      for (uint32_t k = 0; k < count; k++) {
+        const xy_float_t pt = curve.point(curve.t_at(batch_dist[k] * curve_scale), curve_end);
+        out_p[k] = p0 + pt.x;
+        out_q[k] = q0 + pt.y;
+      }
+    }
+  #endif
+
   #if HAS_EXTRUDERS
     if (cfg.linearAdvEna) {
-      float dedt_adj = (traj.e[makeVector_batchIdx] - e_raw_z1) * (FTM_FS);
-      if (ratio.e > 0.0f) dedt_adj += accel_k * cfg.linearAdvK;
+      float * const e = &traj.e[makeVector_batchIdx];
+      for (uint32_t k = 0; k < count; k++) {
+        float dedt_adj = (e[k] - e_raw_z1) * (FTM_FS);
+        if (ratio.e > 0.0f) {
+          const uint32_t i = idx0 + k;
+          #if ENABLED(S_CURVE_ACCELERATION)
+            const float a = i < N1 ? accel_P * s_curve_accel((i + 1) * (FTM_TS) * T1_rcp)
+                          : i < N12 ? 0.0f
+                          : decel_P * s_curve_accel((i + 1 - N12) * (FTM_TS) * T3_rcp);
+            dedt_adj += a * cfg.linearAdvK;                         // (mm/s^2) Acceleration K factor at this point
+          #else
+            dedt_adj += (i < N1 ? accel_P : i < N12 ? 0.0f : decel_P) * cfg.linearAdvK; // (mm/s^2) Acceleration K factor of the phase
+          #endif
+        }
+        e_raw_z1 = e[k];
+        e_advanced_z1 += dedt_adj * (FTM_TS);
+        e[k] = e_advanced_z1;
+      }
+    }
+  #endif
+
+  // Apply shaping if in mode.
+  #if HAS_X_AXIS
+    const bool shaper = cfg.modeHasShaper();
+    #define _FTM_SHAPE(A, I, N) shaping.A.shape(&traj.A[I], N, shaping.zi_idx, shaping.max_i)
+  #endif
 
-      e_raw_z1 = traj.e[makeVector_batchIdx];
-      e_advanced_z1 += dedt_adj * (FTM_TS);
-      traj.e[makeVector_batchIdx] = e_advanced_z1;
+  if (cfg.dynFreqMode != dynFreqMode_DISABLED) {
+    // Shaping parameters follow the trajectory, so go point by point
+    for (uint32_t k = 0; k < count; k++) {
+      const uint32_t i = makeVector_batchIdx + k;
+      updateDynFreq(i);
+      #if HAS_X_AXIS
+        if (shaper) {
+          _FTM_SHAPE(x, i, 1);
+          TERN_(HAS_Y_AXIS, _FTM_SHAPE(y, i, 1));
+          if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
+        }
+      #endif
+    }
+  }
+  #if HAS_X_AXIS
+    else if (shaper) {
+      _FTM_SHAPE(x, makeVector_batchIdx, count);
+      TERN_(HAS_Y_AXIS, _FTM_SHAPE(y, makeVector_batchIdx, count));
+      shaping.zi_idx = (shaping.zi_idx + count) % (FTM_ZMAX);
     }
   #endif
 
-  // Update shaping parameters if needed.
+  // Filled up the queue with regular and shaped steps
+  makeVector_batchIdx += count;
+  if (makeVector_batchIdx == FTM_WINDOW_SIZE) {
+    makeVector_batchIdx = last_batchIdx;
+    batchRdy = true;
+  }
+
+  makeVector_idx += count;
+  if (makeVector_idx >= max_intervals) {
+    blockProcDn = true;
+    blockProcRdy = false;
+    makeVector_idx = 0;
+  }
+}
+
+// Update shaping parameters for the data point at the given index, if needed.
+void FTMotion::updateDynFreq(const uint32_t idx) {
+  UNUSED(idx);
 
   switch (cfg.dynFreqMode) {
 
     #if HAS_DYNAMIC_FREQ_MM
       case dynFreqMode_Z_BASED:
-        if (traj.z[makeVector_batchIdx] != 0.0f) { // Only update if Z changed.
-                 const float xf = cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.z[makeVector_batchIdx]
-          OPTARG(HAS_Y_AXIS, yf = cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.z[makeVector_batchIdx]);
+        if (traj.z[idx] != 0.0f) { // Only update if Z changed.
+                 const float xf = cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.z[idx]
+          OPTARG(HAS_Y_AXIS, yf = cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.z[idx]);
           updateShapingN(_MAX(xf, FTM_MIN_SHAPE_FREQ) OPTARG(HAS_Y_AXIS, _MAX(yf, FTM_MIN_SHAPE_FREQ)));
         }
         break;
@@ -690,46 +857,13 @@ void FTMotion::makeVector() {
       case dynFreqMode_MASS_BASED:
         // Update constantly. The optimization done for Z value makes
         // less sense for E, as E is expected to constantly change.
-        updateShapingN(      cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.e[makeVector_batchIdx]
-          OPTARG(HAS_Y_AXIS, cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.e[makeVector_batchIdx]) );
+        updateShapingN(      cfg.baseFreq[X_AXIS] + cfg.dynFreqK[X_AXIS] * traj.e[idx]
+          OPTARG(HAS_Y_AXIS, cfg.baseFreq[Y_AXIS] + cfg.dynFreqK[Y_AXIS] * traj.e[idx]) );
         break;
     #endif
 
     default: break;
   }
-
-  // Apply shaping if in mode.
-  #if HAS_X_AXIS
-    if (cfg.modeHasShaper()) {
-      shaping.x.d_zi[shaping.zi_idx] = traj.x[makeVector_batchIdx];
-      traj.x[makeVector_batchIdx] *= shaping.x.Ai[0];
-      #if HAS_Y_AXIS
-        shaping.y.d_zi[shaping.zi_idx] = traj.y[makeVector_batchIdx];
-        traj.y[makeVector_batchIdx] *= shaping.y.Ai[0];
-      #endif
-      for (uint32_t i = 1U; i <= shaping.max_i; i++) {
-        const uint32_t udiffx = shaping.zi_idx - shaping.x.Ni[i];
-        traj.x[makeVector_batchIdx] += shaping.x.Ai[i] * shaping.x.d_zi[shaping.x.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffx : udiffx];
-        #if HAS_Y_AXIS
-          const uint32_t udiffy = shaping.zi_idx - shaping.y.Ni[i];
-          traj.y[makeVector_batchIdx] += shaping.y.Ai[i] * shaping.y.d_zi[shaping.y.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffy : udiffy];
-        #endif
-      }
-      if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
-    }
-  #endif
-
-  // Filled up the queue with regular and shaped steps
-  if (++makeVector_batchIdx == FTM_WINDOW_SIZE) {
-    makeVector_batchIdx = last_batchIdx;
-    batchRdy = true;
-  }
-
-  if (++makeVector_idx == max_intervals) {
-    blockProcDn = true;
-    blockProcRdy = false;
-    makeVector_idx = 0;
-  }
 }
 
 /**
@@ -754,58 +888,52 @@ static void command_set_neg(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd,
   e += FTM_STEPS_PER_UNIT_TIME;
 }
 
-// Interpolates single data point to stepper commands.
-void FTMotion::convertToSteps(const uint32_t idx) {
-  xyze_long_t err_P = { 0 };
+// Interpolates a run of data points to stepper commands.
+void FTMotion::convertToSteps(const uint32_t idx, const uint32_t count) {
 
+  // Step targets for the whole run, one axis at a time
   //#define STEPS_ROUNDING
-  #if ENABLED(STEPS_ROUNDING)
-    #define TOSTEPS(A,B) int32_t(trajMod.A[idx] * planner.settings.axis_steps_per_mm[B] + (trajMod.A[idx] < 0.0f ? -0.5f : 0.5f))
-    const xyze_long_t steps_tar = LOGICAL_AXIS_ARRAY(
-      TOSTEPS(e, E_AXIS_N(stepper.current_block->extruder)), // May be eliminated if guaranteed positive.
-      TOSTEPS(x, X_AXIS), TOSTEPS(y, Y_AXIS), TOSTEPS(z, Z_AXIS),
-      TOSTEPS(i, I_AXIS), TOSTEPS(j, J_AXIS), TOSTEPS(k, K_AXIS),
-      TOSTEPS(u, U_AXIS), TOSTEPS(v, V_AXIS), TOSTEPS(w, W_AXIS)
-    );
-    xyze_long_t delta = steps_tar - steps;
-  #else
-    #define TOSTEPS(A,B) int32_t(trajMod.A[idx] * planner.settings.axis_steps_per_mm[B]) - steps.A
-    xyze_long_t delta = LOGICAL_AXIS_ARRAY(
-      TOSTEPS(e, E_AXIS_N(stepper.current_block->extruder)),
-      TOSTEPS(x, X_AXIS), TOSTEPS(y, Y_AXIS), TOSTEPS(z, Z_AXIS),
-      TOSTEPS(i, I_AXIS), TOSTEPS(j, J_AXIS), TOSTEPS(k, K_AXIS),
-      TOSTEPS(u, U_AXIS), TOSTEPS(v, V_AXIS), TOSTEPS(w, W_AXIS)
-    );
-  #endif
+  LOOP_LOGICAL_AXES(a) {
+    const float spm = planner.settings.axis_steps_per_mm[TERN_(HAS_EXTRUDERS, a == E_AXIS ? E_AXIS_N(stepper.current_block->extruder) :) a];
+    const float * const pos = &trajMod.data[a][idx];
+    int32_t * const tar = batch_steps[a];
+    for (uint32_t k = 0; k < count; k++)
+      tar[k] = int32_t(pos[k] * spm TERN_(STEPS_ROUNDING, + (pos[k] < 0.0f ? -0.5f : 0.5f)));
+  }
 
-  #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
-  LOGICAL_AXIS_MAP(_COMMAND_SET);
+  for (uint32_t k = 0; k < count; k++) {
+    xyze_long_t err_P = { 0 }, delta;
+    LOOP_LOGICAL_AXES(a) delta[a] = batch_steps[a][k] - steps[a];
 
-  for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
+    #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
+    LOGICAL_AXIS_MAP(_COMMAND_SET);
 
-    ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
+    for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
 
-    // Init all step/dir bits to 0 (defaulting to reverse/negative motion)
-    cmd = 0;
+      ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
 
-    // Mark the start of a new block
-    if (markBlockStart) {
-      cmd = _BV(FT_BIT_START);
-      markBlockStart = false;
-    }
+      // Init all step/dir bits to 0 (defaulting to reverse/negative motion)
+      cmd = 0;
 
-    // Accumulate the errors for all axes
-    err_P += delta;
+      // Mark the start of a new block
+      if (markBlockStart) {
+        cmd = _BV(FT_BIT_START);
+        markBlockStart = false;
+      }
 
-    // Set up step/dir bits for all axes
-    #define _COMMAND_RUN(AXIS) command_set[_AXIS(AXIS)](err_P[_AXIS(AXIS)], steps[_AXIS(AXIS)], cmd, _BV(FT_BIT_DIR_##AXIS), _BV(FT_BIT_STEP_##AXIS));
-    LOGICAL_AXIS_MAP(_COMMAND_RUN);
+      // Accumulate the errors for all axes
+      err_P += delta;
 
-    // Next circular buffer index
-    if (++stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE))
-      stepperCmdBuff_produceIdx = 0;
+      // Set up step/dir bits for all axes
+      #define _COMMAND_RUN(AXIS) command_set[_AXIS(AXIS)](err_P[_AXIS(AXIS)], steps[_AXIS(AXIS)], cmd, _BV(FT_BIT_DIR_##AXIS), _BV(FT_BIT_STEP_##AXIS));
+      LOGICAL_AXIS_MAP(_COMMAND_RUN);
 
-  } // FTM_STEPS_PER_UNIT_TIME loop
+      // Next circular buffer index
+      if (++stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE))
+        stepperCmdBuff_produceIdx = 0;
+
+    } // FTM_STEPS_PER_UNIT_TIME loop
+  }
 }
 
 #endif // FT_MOTION
@@ -149,6 +149,11 @@ class FTMotion {
     static xyze_pos_t   startPosn,          // (mm) Start position of block
                         endPosn_prevBlock;  // (mm) End position of previous block
     static xyze_float_t ratio;              // (ratio) Axis move ratio of block
+    #if ENABLED(FTM_CURVES)
+      static block_curve_t curve;           // Curve followed by a curve block
+      static xy_float_t curve_end;          // (mm) End of the curve, relative to startPosn
+      static float curve_scale;             // (1/mm) Reciprocal of the curve block length. 0 for a straight block.
+    #endif
     static float accel_P, decel_P,
                  F_P,
                  f_s,
@@ -186,6 +191,7 @@ class FTMotion {
         uint32_t Ni[5];                   // Shaping time index vector.
 
         void updateShapingN(const_float_t f, const_float_t df);
+        void shape(float * const data, const uint32_t count, uint32_t zi_idx, const uint32_t max_i);
 
       } axis_shaping_t;
 
@@ -214,7 +220,8 @@ class FTMotion {
     static int32_t stepperCmdBuffItems();
     static void loadBlockData(block_t *const current_block);
     static void makeVector();
-    static void convertToSteps(const uint32_t idx);
+    static void updateDynFreq(const uint32_t idx);
+    static void convertToSteps(const uint32_t idx, const uint32_t count);
 
     FORCE_INLINE static int32_t num_samples_cmpnstr_settle() { return ( shaping.x.ena || shaping.y.ena ) ? FTM_ZMAX : 0; }
 
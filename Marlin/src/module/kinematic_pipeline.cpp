@@ -0,0 +1,129 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(KINEMATIC_IK_LINEARIZE)
+
+#include "kinematic_pipeline.h"
+#include "motion.h"
+
+#if ENABLED(DELTA)
+  #include "delta.h"
+#elif ENABLED(POLAR)
+  #include "polar.h"
+#elif IS_SCARA
+  #include "scara.h"
+#endif
+
+KinematicPipeline kinematicPipeline;
+
+xyze_pos_t KinematicPipeline::pending[KINEMATIC_IK_MAX_SPAN];
+uint8_t KinematicPipeline::count, // = 0
+        KinematicPipeline::span = KINEMATIC_IK_MAX_SPAN;
+bool KinematicPipeline::primed; // = false
+abce_pos_t KinematicPipeline::joints;
+feedRate_t KinematicPipeline::feedrate;
+PlannerHints KinematicPipeline::hints;
+
+void KinematicPipeline::start(const_feedRate_t fr_mm_s, const PlannerHints &h) {
+  feedrate = fr_mm_s;
+  hints = h;
+  count = 0;
+  primed = false;
+}
+
+bool KinematicPipeline::add(const xyze_pos_t &raw) {
+  if (!primed) {
+    primed = true;
+    joints = exact(raw);
+    return planner.buffer_kinematic_line(raw, joints, feedrate, active_extruder, hints);
+  }
+  pending[count++] = raw;
+  return count < span || flush(false);
+}
+
+bool KinematicPipeline::finish() {
+  const bool ok = flush(true);
+  primed = false;
+  return ok;
+}
+
+// Joint positions for a raw position, the same as Planner::buffer_line
+abce_pos_t KinematicPipeline::exact(const xyze_pos_t &raw) {
+  xyze_pos_t machine = raw;
+  #if ENABLED(LEVELING_CORRECTION_STREAM)
+    planner.apply_modifiers(machine, !hints.leveled);
+  #elif HAS_POSITION_MODIFIERS
+    planner.apply_modifiers(machine);
+  #endif
+  inverse_kinematics(machine);
+  TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+  return delta;
+}
+
+/**
+ * Send pending segments to the planner one span at a time.
+ * With 'all' send everything, otherwise stop when less than a span remains.
+ */
+bool KinematicPipeline::flush(const bool all) {
+  while (count && (all || count >= span)) {
+    uint8_t n = _MIN(span, count);
+    abce_pos_t end = exact(pending[n - 1]);
+
+    // Compare the middle of the span to the straight line between its ends
+    while (n > 1) {
+      const uint8_t m = n / 2;
+      const abce_pos_t mid = exact(pending[m - 1]);
+      const float f = float(m) / float(n);
+      float err = 0;
+      LOOP_NUM_AXES(i) NOLESS(err, ABS(mid[i] - (joints[i] + (end[i] - joints[i]) * f)));
+
+      if (err <= KINEMATIC_IK_TOLERANCE) {
+        // Quarter of the tolerance, so twice the span should still be good
+        if (n == span && err < (KINEMATIC_IK_TOLERANCE) * 0.25f) span = _MIN(span * 2, KINEMATIC_IK_MAX_SPAN);
+        break;
+      }
+
+      // Too far off. The middle becomes the end of a shorter span.
+      end = mid;
+      span = n = m;
+    }
+
+    // Step the joints along the span
+    const abce_pos_t step = (end - joints) / float(n);
+    for (uint8_t j = 1; j <= n; ++j) {
+      const abce_pos_t q = j < n ? joints + step * float(j) : end;
+      if (!planner.buffer_kinematic_line(pending[j - 1], q, feedrate, active_extruder, hints)) {
+        count = 0;
+        return false;
+      }
+    }
+    joints = end;
+
+    count -= n;
+    for (uint8_t i = 0; i < count; ++i) pending[i] = pending[i + n];
+  }
+  return true;
+}
+
+#endif // KINEMATIC_IK_LINEARIZE
@@ -0,0 +1,62 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * kinematic_pipeline.h - Linearized inverse kinematics for segmented moves
+ *
+ * The segment targets of a kinematic move are collected into spans. Exact
+ * inverse kinematics is only done at the end and the middle of each span, and
+ * the joints of the other segments are interpolated linearly between the exact
+ * points at either end of the span. A span whose middle is off by more than
+ * KINEMATIC_IK_TOLERANCE is cut in half, and a span well inside the tolerance
+ * lets the next one double, up to KINEMATIC_IK_MAX_SPAN segments.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "planner.h"
+
+class KinematicPipeline {
+  public:
+    // Begin a new move. The first segment target is sent with exact kinematics.
+    static void start(const_feedRate_t fr_mm_s, const PlannerHints &hints);
+
+    // Add the next segment target. Return false if the planner refused a segment.
+    static bool add(const xyze_pos_t &raw);
+
+    // Send all remaining segments to the planner
+    static bool finish();
+
+  private:
+    static xyze_pos_t pending[KINEMATIC_IK_MAX_SPAN]; // Segment targets waiting for joint positions
+    static uint8_t count,                             // Number of pending targets
+                   span;                              // Segments to the next exact point
+    static bool primed;                               // 'joints' holds the last segment sent
+    static abce_pos_t joints;                         // Joint positions of the last segment sent
+    static feedRate_t feedrate;
+    static PlannerHints hints;
+
+    static abce_pos_t exact(const xyze_pos_t &raw);
+    static bool flush(const bool all);
+};
+
+extern KinematicPipeline kinematicPipeline;
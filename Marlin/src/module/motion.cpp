@@ -70,6 +70,14 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(KINEMATIC_IK_LINEARIZE)
+  #include "kinematic_pipeline.h"
+#endif
+
+#if ENABLED(LEVELING_CORRECTION_STREAM)
+  #include "../feature/bedlevel/leveling_stream.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
@@ -1283,14 +1291,28 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
     // Get the current position as starting point
     xyze_pos_t raw = current_position;
 
+    // Level the segments here from the mesh cells the move crosses
+    #if ENABLED(LEVELING_CORRECTION_STREAM)
+      levelingStream.start(raw, segment_distance, segments);
+      hints.leveled = true;
+    #endif
+
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
+    TERN_(KINEMATIC_IK_LINEARIZE, kinematicPipeline.start(scaled_fr_mm_s, hints));
     while (--segments) {
       segment_idle(next_idle_ms);
       raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
+      const xyze_pos_t target = TERN(LEVELING_CORRECTION_STREAM, levelingStream.leveled(raw), raw);
+      #if ENABLED(KINEMATIC_IK_LINEARIZE)
+        if (!kinematicPipeline.add(target)) break;
+      #else
+        if (!planner.buffer_line(target, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      #endif
     }
+    TERN_(KINEMATIC_IK_LINEARIZE, kinematicPipeline.finish());
+    TERN_(LEVELING_CORRECTION_STREAM, hints.leveled = false);
 
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
@@ -1352,14 +1374,21 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
       // Get the raw current position as starting point
       xyze_pos_t raw = current_position;
 
+      // Level the segments here from the mesh cells the move crosses
+      #if ENABLED(LEVELING_CORRECTION_STREAM)
+        levelingStream.start(raw, segment_distance, segments);
+        hints.leveled = true;
+      #endif
+
       // Calculate and execute the segments
       millis_t next_idle_ms = millis() + 200UL;
       while (--segments) {
         segment_idle(next_idle_ms);
         raw += segment_distance;
-        if (!planner.buffer_line(raw, fr_mm_s, active_extruder, hints))
+        if (!planner.buffer_line(TERN(LEVELING_CORRECTION_STREAM, levelingStream.leveled(raw), raw), fr_mm_s, active_extruder, hints))
           break;
       }
+      TERN_(LEVELING_CORRECTION_STREAM, hints.leveled = false);
 
       // Since segment_distance is only approximate,
       // the final move must be to the exact destination.
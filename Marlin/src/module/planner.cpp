@@ -72,9 +72,16 @@
 #if ENABLED(FT_MOTION)
   #include "ft_motion.h"
 #endif
+#if ENABLED(STEP_COMPRESSION)
+  #include "step_compress.h"
+#endif
 #include "../lcd/marlinui.h"
 #include "../gcode/parser.h"
 
+#if ENABLED(ARC_STREAMING)
+  #include "../gcode/gcode.h"
+#endif
+
 #include "../MarlinCore.h"
 
 #if HAS_LEVELING
@@ -113,6 +120,10 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "../feature/planner_benchmark.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -815,46 +826,91 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
           decelerate_steps = 0;
 
   const int32_t accel = block->acceleration_steps_per_s2;
-  float inverse_accel = 0.0f;
-  if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
-                accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
-    // Aims to fully reach nominal and final rates
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = CEIL(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
-      #endif
+
+  #if ENABLED(TRAPEZOID_INTEGER_MATH)
+
+    if (accel != 0) {
+      // Steps required for acceleration, deceleration to/from nominal rate, with remainders
+      uint32_t accelerate_rem, decelerate_rem;
+      const uint32_t accelerate_floor = trap_accel_steps(block->nominal_rate, initial_rate, accel, accelerate_rem),
+                     decelerate_floor = trap_accel_steps(block->nominal_rate, final_rate, accel, decelerate_rem);
+
+      // Aims to fully reach nominal and final rates
+      accelerate_steps = accelerate_floor + (accelerate_rem != 0);
+      decelerate_steps = decelerate_floor + (decelerate_rem != 0);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // No cruising. Split the block so the final_rate is reached exactly at the end.
+      // Same as rounding (step_event_count + accelerate - decelerate) / 2 with the exact
+      // fractional distances, which only matter when the integer sum is odd.
+      if (plateau_steps < 0) {
+        const int32_t k = int32_t(block->step_event_count) + int32_t(accelerate_floor) - int32_t(decelerate_floor);
+        accelerate_steps = k < 0 ? 0 : (k >> 1) + ((k & 1) && accelerate_rem >= decelerate_rem);
+        NOMORE(accelerate_steps, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          NOMORE(cruise_rate, trap_final_rate(initial_rate, accel, accelerate_steps));
+        #endif
+      }
     }
-  }
 
-  #if ENABLED(S_CURVE_ACCELERATION)
-    const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
-             deceleration_time = rate_factor * float(cruise_rate - final_rate),
-    // And to offload calculations from the ISR, we also calculate the inverse of those times here
-             acceleration_time_inverse = get_period_inverse(acceleration_time),
-             deceleration_time_inverse = get_period_inverse(deceleration_time);
-  #endif
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      uint32_t acceleration_time = accel ? trap_accel_ticks(cruise_rate - initial_rate, accel) : 0,
+               deceleration_time = accel ? trap_accel_ticks(cruise_rate - final_rate, accel) : 0,
+      // And to offload calculations from the ISR, we also calculate the inverse of those times here
+               acceleration_time_inverse = get_period_inverse(acceleration_time),
+               deceleration_time_inverse = get_period_inverse(deceleration_time);
+    #endif
+
+  #else // !TRAPEZOID_INTEGER_MATH
+
+    float inverse_accel = 0.0f;
+    if (accel != 0) {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = FLOAT_SQ(block->nominal_rate),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(final_rate)),
+                  accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - FLOAT_SQ(initial_rate));
+      // Aims to fully reach nominal and final rates
+      accelerate_steps = CEIL(accelerate_steps_float);
+      decelerate_steps = CEIL(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps = LROUND((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        LIMIT(accelerate_steps, 0, int32_t(block->step_event_count));
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          NOMORE(cruise_rate, final_speed(initial_rate, accel, accelerate_steps));
+        #endif
+      }
+    }
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
+               deceleration_time = rate_factor * float(cruise_rate - final_rate),
+      // And to offload calculations from the ISR, we also calculate the inverse of those times here
+               acceleration_time_inverse = get_period_inverse(acceleration_time),
+               deceleration_time_inverse = get_period_inverse(deceleration_time);
+    #endif
+
+  #endif // !TRAPEZOID_INTEGER_MATH
 
   // Store new block parameters
   block->accelerate_before = accelerate_steps;
@@ -959,7 +1015,8 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
  *    1. We keep track of which blocks need calculation (block->flag.recalculate)
  *    2. We stop the reverse pass on the first block whose entry_speed == max_entry_speed. As soon
  *       as that happens, there can be no further increases (ensured by the previous recalculate)
- *    3. On the forward pass we skip through to the first block with a modified exit speed
+ *    3. On the forward pass we start at the last move ahead of the oldest block touched by the
+ *       reverse pass, and skip through to the first block with a modified exit speed
  *       (next->entry_speed)
  *    4. On the forward pass if we encounter a full acceleration block that limits its exit speed
  *       (next->entry_speed) we also update the maximum for that junction (next->max_entry_speed)
@@ -1032,11 +1089,16 @@ bool Planner::reverse_pass_kernel(block_t * const current, const block_t * const
  * Once in reverse and once forward. This implements the reverse pass that
  * coarsely maximizes the entry speeds starting from last block.
  * Requires there's at least one block with flag.recalculate in the buffer.
+ * Returns the index of the oldest block marked for recalculation. Blocks
+ * ahead of it are already planned and don't need to be revisited.
  */
-void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
+uint8_t Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
+  TERN_(PLANNER_BENCHMARK, PLANNER_BENCH_SECTION(REVERSE_PASS));
+
   // Initialize block index to the last block in the planner buffer.
   // This last block will have flag.recalculate set.
-  uint8_t block_index = prev_block_index(block_buffer_head);
+  uint8_t block_index = prev_block_index(block_buffer_head),
+          dirty_index = block_index;
 
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
   uint8_t nonbusy_block_index = block_buffer_nonbusy;
@@ -1049,7 +1111,8 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
     // Only process movement blocks
     if (current->is_move()) {
       // If no entry speed increase was possible we end the reverse pass.
-      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return;
+      if (!reverse_pass_kernel(current, next, safe_exit_speed_sqr)) return dirty_index;
+      dirty_index = block_index;
       next = current;
     }
 
@@ -1061,12 +1124,13 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
     while (nonbusy_block_index != block_buffer_nonbusy) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == nonbusy_block_index) return;
+      if (block_index == nonbusy_block_index) return dirty_index;
 
       // Advance the pointer, following the busy block
       nonbusy_block_index = next_block_index(nonbusy_block_index);
     }
   }
+  return dirty_index;
 }
 
 // The kernel called during the forward pass. Assumes current->flag.recalculate.
@@ -1093,12 +1157,27 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
 
 /**
  * Do the forward pass and recalculate the trapezoid speed profiles for all blocks in the plan
- * according to entry/exit speeds.
+ * according to entry/exit speeds. Only the blocks from 'dirty_index' onward (plus the move
+ * before them, whose exit speed changes) need work, so the cost follows the number of blocks
+ * the reverse pass touched and not the size of the buffer.
  */
-void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
+void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr, const uint8_t dirty_index) {
+  TERN_(PLANNER_BENCHMARK, PLANNER_BENCH_SECTION(RECALC_TRAPEZOIDS));
+
   // Start with the block that's about to execute or is executing.
-  uint8_t block_index = block_buffer_tail,
-          head_block_index = block_buffer_head;
+  const uint8_t tail_block_index = block_buffer_tail,
+                head_block_index = block_buffer_head;
+  uint8_t block_index = tail_block_index;
+
+  // If the first changed block is still queued, start with the move block ahead of it instead.
+  // All the blocks in between have no pending changes.
+  if (block_dec_mod(dirty_index, tail_block_index) < block_dec_mod(head_block_index, tail_block_index)) {
+    block_index = dirty_index;
+    while (block_index != tail_block_index) {
+      block_index = prev_block_index(block_index);
+      if (block_buffer[block_index].is_move()) break;
+    }
+  }
 
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
@@ -1171,9 +1250,9 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
 
 // Requires there's at least one block with flag.recalculate in the buffer
 void Planner::recalculate(const_float_t safe_exit_speed_sqr) {
-  reverse_pass(safe_exit_speed_sqr);
+  const uint8_t dirty_index = reverse_pass(safe_exit_speed_sqr);
   // The forward pass is done as part of recalculate_trapezoids()
-  recalculate_trapezoids(safe_exit_speed_sqr);
+  recalculate_trapezoids(safe_exit_speed_sqr, dirty_index);
 }
 
 /**
@@ -1580,6 +1659,9 @@ void Planner::quick_stop() {
 
   const bool was_enabled = stepper.suspend();
 
+  // Drop the rest of a G2/G3 arc
+  TERN_(ARC_STREAMING, gcode.cancel_arc());
+
   // Drop all queue entries
   block_buffer_nonbusy = block_buffer_head = block_buffer_tail;
 
@@ -1633,9 +1715,32 @@ bool Planner::busy() {
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
       || TERN0(HAS_ZV_SHAPING, stepper.input_shaping_busy())
       || TERN0(FT_MOTION, ftMotion.busy)
+      || TERN0(STEP_COMPRESSION, stepCompressor.busy())
+      || TERN0(ARC_STREAMING, gcode.arc_pending())
   );
 }
 
+#if ENABLED(MPC_FEED_FORWARD)
+
+  /**
+   * Add up the queued moves, starting with the busy block, until 'seconds' of moves
+   * are counted. Each block is timed at its nominal speed. Retractions count as moves
+   * without extrusion. Moves for other extruders end the count.
+   */
+  float Planner::planned_e_speed(const uint8_t extruder, const_float_t seconds) {
+    float time = 0, e_mm = 0;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head && time < seconds; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move()) continue;
+      if (TERN0(HAS_MULTI_EXTRUDER, block->extruder != extruder)) break;
+      if (block->nominal_speed > 0) time += block->millimeters / block->nominal_speed;
+      if (block->direction_bits.e) e_mm += block->steps.e * mm_per_step[E_AXIS_N(extruder)];
+    }
+    return time > 0 ? e_mm / time : NAN;
+  }
+
+#endif // MPC_FEED_FORWARD
+
 void Planner::finish_and_disable() {
   while (has_blocks_queued() || cleaning_buffer_counter) idle();
   stepper.disable_all_steppers();
@@ -1697,7 +1802,10 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(ARC_STREAMING, gcode.finish_arc()); // The command queue can't queue the rest of the arc meanwhile
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1790,6 +1898,8 @@ bool Planner::_populate_block(
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
   , float &minimum_planner_speed_sqr
 ) {
+  TERN_(PLANNER_BENCHMARK, PLANNER_BENCH_SECTION(POPULATE_BLOCK));
+
   xyze_long_t dist = target - position;
 
   /* <-- add a slash to enable
@@ -1920,6 +2030,13 @@ bool Planner::_populate_block(
   // Set direction bits
   block->direction_bits = dm;
 
+  #if ENABLED(FTM_CURVES)
+    if (hints.curve) {
+      block->flag.apply(BLOCK_BIT_CURVE);
+      block->curve = *hints.curve;
+    }
+  #endif
+
   /**
    * Update block laser power
    * For standard mode get the cutter.power value for processing, since it's
@@ -2272,6 +2389,18 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
+  #if ENABLED(FTM_CURVES)
+    // Either plane axis may take the whole speed somewhere on a curve,
+    // and the centripetal acceleration must stay within the axis limits
+    if (hints.curve) {
+      const block_curve_t &c = *hints.curve;
+      const float plane_speed = c.plane_mm * inverse_secs,
+                  max_accel = _MIN(settings.max_acceleration_mm_per_s2[c.axis_p], settings.max_acceleration_mm_per_s2[c.axis_q]),
+                  max_speed = _MIN(settings.max_feedrate_mm_s[c.axis_p], settings.max_feedrate_mm_s[c.axis_q], SQRT(max_accel * c.min_radius));
+      if (plane_speed > max_speed) NOMORE(speed_factor, max_speed / plane_speed);
+    }
+  #endif
+
   // Limit speed on extruders, if any
   #if HAS_EXTRUDERS
   {
@@ -2431,6 +2560,14 @@ bool Planner::_populate_block(
         LIMIT_ACCEL_FLOAT(U_AXIS, 0), LIMIT_ACCEL_FLOAT(V_AXIS, 0), LIMIT_ACCEL_FLOAT(W_AXIS, 0)
       );
     }
+
+    #if ENABLED(FTM_CURVES)
+      // Either plane axis may take the whole acceleration somewhere on a curve
+      if (hints.curve) {
+        const block_curve_t &c = *hints.curve;
+        NOMORE(accel, uint32_t(_MIN(settings.max_acceleration_mm_per_s2[c.axis_p], settings.max_acceleration_mm_per_s2[c.axis_q]) * steps_per_mm));
+      }
+    #endif
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
@@ -2506,6 +2643,12 @@ bool Planner::_populate_block(
     // Unit vector of previous path line segment
     static xyze_float_t prev_unit_vec;
 
+    #if ENABLED(JD_CORNER_BLENDING)
+      // XY turns and lengths of the latest run of short segments
+      static float blend_turn[JD_BLEND_BLOCKS], blend_mm[JD_BLEND_BLOCKS];
+      static uint8_t blend_count, blend_index;
+    #endif
+
     xyze_float_t unit_vec =
       #if HAS_DIST_MM_ARG
         cart_dist_mm
@@ -2523,6 +2666,24 @@ bool Planner::_populate_block(
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
+    #if ENABLED(FTM_CURVES)
+      // A curve starts along its first tangent and ends along its last
+      xyze_float_t end_unit_vec = unit_vec;
+      if (hints.curve) {
+        const block_curve_t &c = *hints.curve;
+        const xy_float_t d = { unit_vec[c.axis_p], unit_vec[c.axis_q] };
+        xy_float_t ts = c.c1, te = d - c.c2;
+        if (ts.magnitude() < 1e-4f) ts = c.c2;
+        if (te.magnitude() < 1e-4f) te = d - c.c1;
+        ts *= c.plane_mm / ts.magnitude();
+        te *= c.plane_mm / te.magnitude();
+        unit_vec[c.axis_p] = ts.x; unit_vec[c.axis_q] = ts.y;
+        end_unit_vec[c.axis_p] = te.x; end_unit_vec[c.axis_q] = te.y;
+        normalize_junction_vector(unit_vec);
+        normalize_junction_vector(end_unit_vec);
+      }
+      else
+    #endif
     if (ANY(IS_CORE, MARKFORGED_XY, MARKFORGED_YX) || esteps > 0)
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
@@ -2549,6 +2710,7 @@ bool Planner::_populate_block(
       if (junction_cos_theta > 0.999999f) {
         // For a 0 degree acute junction, just set minimum junction speed.
         vmax_junction_sqr = minimum_planner_speed_sqr;
+        TERN_(JD_CORNER_BLENDING, blend_count = 0);
       }
       else {
         // Convert delta vector to unit vector
@@ -2655,14 +2817,62 @@ bool Planner::_populate_block(
 
           #endif // JD_HANDLE_SMALL_SEGMENTS
         }
+
+        #if ENABLED(JD_CORNER_BLENDING)
+          /**
+           * Short segments that keep turning the same way by similar angles in XY
+           * most likely follow a smooth curve. Limit the speed by the curvature of
+           * the whole run (turn per mm) so a single sharper vertex doesn't slow it.
+           * The vertex is then taken faster than its own junction deviation allows,
+           * so this is capped at JD_BLEND_MAX_FACTOR times the vertex speed limit.
+           */
+          const float pxy = HYPOT(prev_unit_vec.x, prev_unit_vec.y),
+                      cxy = HYPOT(unit_vec.x, unit_vec.y),
+                      pc = pxy * cxy,
+                      turn = pc > 0.5f ? (prev_unit_vec.x * unit_vec.y - prev_unit_vec.y * unit_vec.x) / pc : 0; // Sine of the XY turn
+          if (block->millimeters < (JD_BLEND_SEGMENT_MM) && pc > 0.5f && ABS(turn) < 0.5f
+            && prev_unit_vec.x * unit_vec.x + prev_unit_vec.y * unit_vec.y > 0
+            && !TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)
+          ) {
+            blend_turn[blend_index] = turn;
+            blend_mm[blend_index] = block->millimeters;
+            if (++blend_index >= JD_BLEND_BLOCKS) blend_index = 0;
+            if (blend_count < JD_BLEND_BLOCKS) ++blend_count;
+          }
+          else
+            blend_count = 0;
+
+          if (blend_count == JD_BLEND_BLOCKS) {
+            // Straight (zero) turns are neutral. They add length but no direction.
+            float turn_min = INFINITY, turn_max = 0, turn_sum = 0, mm_sum = 0;
+            int8_t way = 0;
+            bool same_way = true;
+            for (uint8_t i = 0; i < JD_BLEND_BLOCKS; ++i) {
+              const float t = blend_turn[i];
+              mm_sum += blend_mm[i];
+              if (t == 0) continue;
+              const int8_t w = t < 0 ? -1 : 1;
+              if (!way) way = w; else if (w != way) same_way = false;
+              NOMORE(turn_min, ABS(t));
+              NOLESS(turn_max, ABS(t));
+              turn_sum += ABS(t);
+            }
+            // Similar turns, within a factor of two, make a smooth curve
+            if (same_way && turn_sum > 0 && turn_max <= 2.0f * turn_min + 0.001f)
+              NOLESS(vmax_junction_sqr, _MIN(junction_acceleration * mm_sum / turn_sum, vmax_junction_sqr * sq(float(JD_BLEND_MAX_FACTOR))));
+          }
+        #endif // JD_CORNER_BLENDING
       }
 
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, sq(block->nominal_speed), sq(previous_nominal_speed));
     }
-    else vmax_junction_sqr = minimum_planner_speed_sqr;
+    else {
+      vmax_junction_sqr = minimum_planner_speed_sqr;
+      TERN_(JD_CORNER_BLENDING, blend_count = 0);
+    }
 
-    prev_unit_vec = unit_vec;
+    prev_unit_vec = TERN(FTM_CURVES, hints.curve ? end_unit_vec : unit_vec, unit_vec);
 
   #else // CLASSIC_JERK
 
@@ -2960,10 +3170,45 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
   , const PlannerHints &hints/*=PlannerHints()*/
 ) {
   xyze_pos_t machine = cart;
-  TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+  #if ENABLED(LEVELING_CORRECTION_STREAM)
+    apply_modifiers(machine, !hints.leveled);
+  #elif HAS_POSITION_MODIFIERS
+    apply_modifiers(machine);
+  #endif
 
   #if IS_KINEMATIC
 
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+
+    return buffer_kinematic_line(cart, delta, fr_mm_s, extruder, hints);
+
+  #else // !IS_KINEMATIC
+
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+
+  #endif
+
+} // buffer_line()
+
+#if IS_KINEMATIC
+
+  /**
+   * Add a new linear movement to the buffer, with the kinematic
+   * joint positions for the target already worked out.
+   *
+   *  cart            - target position in mm or degrees
+   *  joints          - joint positions for 'cart', with modifiers applied
+   *  fr_mm_s         - (target) speed of the move (mm/s)
+   *  extruder        - optional target extruder (otherwise active_extruder)
+   *  hints           - optional parameters to aid planner calculations
+   */
+  bool Planner::buffer_kinematic_line(const xyze_pos_t &cart, const abce_pos_t &joints, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
         cart.e - position_cart.e,
@@ -2979,9 +3224,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = get_move_distance(xyze_pos_t(cart_dist_mm) OPTARG(HAS_ROTATIONAL_AXES, ph.cartesian_move));
@@ -2995,7 +3237,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       // For SCARA scale the feedrate from mm/s to degrees/s
       // i.e., Complete the angular vector in the given time.
       const float duration_recip = hints.inv_duration ?: fr_mm_s / ph.millimeters;
-      const xyz_pos_t diff = delta - position_float;
+      const xyz_pos_t diff = joints - position_float;
       const feedRate_t feedrate = diff.magnitude() * duration_recip;
 
     #elif ENABLED(POLAR)
@@ -3023,9 +3265,9 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
        * This shouldn't be a problem for cutting/milling operations.
        */
       feedRate_t calculated_feedrate = fr_mm_s;
-      const xyz_pos_t diff = delta - position_float;
+      const xyz_pos_t diff = joints - position_float;
       if (!NEAR_ZERO(diff.b)) {
-        if (delta.a <= POLAR_FAST_RADIUS )
+        if (joints.a <= POLAR_FAST_RADIUS )
           calculated_feedrate = settings.max_feedrate_mm_s[Y_AXIS];
         else {
           // Normalized vector of movement
@@ -3034,7 +3276,7 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
                       normalizedTheta = 1.0f - (ABS(diffTheta > 90.0f ? 180.0f - diffTheta : diffTheta) / 90.0f);
 
           // Normalized position along the radius
-          const float radiusRatio = (PRINTABLE_RADIUS) / delta.a;
+          const float radiusRatio = (PRINTABLE_RADIUS) / joints.a;
           calculated_feedrate += (fr_mm_s * radiusRatio * normalizedTheta);
         }
       }
@@ -3042,20 +3284,87 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
 
     #endif // POLAR && FEEDRATE_SCALING
 
-    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
-    if (buffer_segment(delta OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
+    if (buffer_segment(joints OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
       position_cart = cart;
       return true;
     }
     return false;
 
-  #else // !IS_KINEMATIC
+  } // buffer_kinematic_line()
 
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
+#endif // IS_KINEMATIC
 
-  #endif
+#if ENABLED(FTM_CURVES)
 
-} // buffer_line()
+  bool Planner::can_buffer_curves() { return ftMotion.cfg.mode && !leveling_active; }
+
+  /**
+   * Add a curve to the buffer as a single block.
+   *
+   *  start           - current position in mm
+   *  cart            - target position in mm
+   *  c1, c2          - control points, relative to the start
+   *  axis_p, axis_q  - axes of the curve plane
+   *  fr_mm_s         - (target) speed of the move (mm/s)
+   *  extruder        - optional target extruder (otherwise active_extruder)
+   *  hints           - optional parameters to aid planner calculations
+   */
+  bool Planner::buffer_curve(const xyze_pos_t &start, const xyze_pos_t &cart,
+    const xy_float_t &c1, const xy_float_t &c2, const AxisEnum axis_p, const AxisEnum axis_q,
+    const_feedRate_t fr_mm_s, const uint8_t extruder/*=active_extruder*/, const PlannerHints &hints/*=PlannerHints()*/
+  ) {
+    constexpr uint8_t subsamples = 4;                   // Chords per length sample
+    constexpr float dt = 1.0f / ((CURVE_LENGTHS) * subsamples);
+
+    block_curve_t curve;
+    curve.axis_p = axis_p;
+    curve.axis_q = axis_q;
+    curve.c1 = c1;
+    curve.c2 = c2;
+
+    const xy_float_t d = { cart[axis_p] - start[axis_p], cart[axis_q] - start[axis_q] };
+
+    // Sample the length and the radius of curvature along the curve
+    float len = 0, min_radius = 1e10f;
+    xy_float_t p = { 0, 0 };
+    curve.length[0] = 0;
+    for (uint8_t i = 0; i <= (CURVE_LENGTHS) * subsamples; ++i) {
+      const float t = i * dt, u = 1.0f - t;
+      if (i) {
+        const xy_float_t q = curve.point(t, d);
+        len += (q - p).magnitude();
+        p = q;
+        if (i % subsamples == 0) curve.length[i / subsamples] = len;
+      }
+
+      // First and second derivatives give the radius of curvature |B'|^3 / |B' x B''|
+      const xy_float_t d1 = (c1 * sq(u) + (c2 - c1) * (2.0f * u * t) + (d - c2) * sq(t)) * 3.0f,
+                       d2 = ((c2 - c1 * 2.0f) * u + (d - c2 * 2.0f + c1) * t) * 6.0f;
+      const float speed = d1.magnitude(), cross = ABS(d1.x * d2.y - d1.y * d2.x);
+      if (speed < 1e-4f) return false;                  // A cusp needs a stop
+      if (cross > 0) NOMORE(min_radius, speed * sq(speed) / cross);
+    }
+
+    // Leave short curves and loops to line segments, since
+    // a block needs steps between its start and end.
+    if (len < 1.0f || d.magnitude() < 0.25f * len) return false;
+
+    for (uint8_t i = 1; i <= CURVE_LENGTHS; ++i) curve.length[i] /= len;
+    curve.plane_mm = len;
+    curve.min_radius = min_radius;
+
+    // The whole length combines the curve with the linear motion of the other axes
+    xyze_pos_t linear = cart - start;
+    linear[axis_p] = linear[axis_q] = 0;
+
+    PlannerHints ph = hints;
+    ph.curve = &curve;
+    ph.millimeters = SQRT(sq(len) + sq(get_move_distance(linear OPTARG(HAS_ROTATIONAL_AXES, ph.cartesian_move))));
+
+    return buffer_line(cart, fr_mm_s, extruder, ph);
+  }
+
+#endif // FTM_CURVES
 
 #if ENABLED(DIRECT_STEPPING)
 
@@ -3065,6 +3374,18 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       return;
     }
 
+    #if ENABLED(DIRECT_STEPPING_STREAM)
+      // The page has to be here to know where it ends, so wait for the rest of it
+      const millis_t timeout_ms = millis() + (DIRECT_STEPPING_PAGE_TIMEOUT);
+      while (!page_manager.page_ok(page_idx) && PENDING(millis(), timeout_ms)) idle();
+
+      const uint8_t * const page = page_manager.get_page(page_idx);
+      if (!page || !page_manager.page_ok(page_idx)) {
+        kill(GET_TEXT_F(MSG_BAD_PAGE));
+        return;
+      }
+    #endif
+
     uint8_t next_buffer_head;
     block_t * const block = get_next_free_block(next_buffer_head);
 
@@ -3092,6 +3413,21 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       LOGICAL_AXIS_MAP(PAGE_UPDATE_DIR);
     }
 
+    #if ENABLED(DIRECT_STEPPING_STREAM)
+      // Move the planner position to the end of the page so G-code moves can follow it
+      position += DirectStepping::page_steps(page, num_steps, block->direction_bits);
+      #if HAS_POSITION_FLOAT
+        position_float.x = position.x * mm_per_step[X_AXIS];
+        position_float.y = position.y * mm_per_step[Y_AXIS];
+        position_float.z = position.z * mm_per_step[Z_AXIS];
+        TERN_(HAS_EXTRUDERS, position_float.e = position.e * mm_per_step[E_AXIS_N(extruder)]);
+      #endif
+
+      // The page runs at its own rate, so moves on either side of it start and end at rest
+      previous_nominal_speed = 0;
+      previous_speed.reset();
+    #endif
+
     // If this is the first added movement, reload the delay, otherwise, cancel it.
     if (block_buffer_head == block_buffer_tail) {
       // If it was the first queued block, restart the 1st block delivery delay, to
@@ -125,6 +125,9 @@ enum BlockFlagBit {
 
   // Sync laser power from a queued block
   OPTARG(LASER_POWER_SYNC, BLOCK_BIT_LASER_PWR)
+
+  // The block follows a curve
+  OPTARG(FTM_CURVES, BLOCK_BIT_CURVE)
 };
 
 /**
@@ -152,6 +155,10 @@ typedef struct {
       #if ENABLED(LASER_POWER_SYNC)
         bool sync_laser_pwr:1;
       #endif
+
+      #if ENABLED(FTM_CURVES)
+        bool curve:1;
+      #endif
     };
   };
 
@@ -162,6 +169,40 @@ typedef struct {
 
 } block_flags_t;
 
+#if ENABLED(FTM_CURVES)
+
+  #define CURVE_LENGTHS 8 // Length samples for an even speed along a curve
+
+  /**
+   * A cubic Bézier curve in the plane of two axes, with linear motion on the other axes.
+   * The control points are relative to the start of the block and the curve ends at the
+   * end of the block. Fixed-Time Motion follows the curve, so one block can stand in for
+   * the many short lines of an arc or G5 curve.
+   */
+  typedef struct {
+    AxisEnum axis_p, axis_q;            // The axes of the curve plane
+    xy_float_t c1, c2;                  // First and second control points
+    float plane_mm,                     // Length of the curve in the plane
+          min_radius;                   // Smallest radius of curvature
+    float length[CURVE_LENGTHS + 1];    // Length up to t = 0, 1/N, 2/N ... 1, as a fraction of plane_mm
+
+    // Curve parameter for a fraction of the length, interpolated from the samples
+    float t_at(const float f) const {
+      uint8_t i = 1;
+      while (i < CURVE_LENGTHS && length[i] < f) ++i;
+      const float l0 = length[i - 1], dl = length[i] - l0;
+      return (i - 1 + (dl > 0 ? (f - l0) / dl : 0.0f)) * (1.0f / (CURVE_LENGTHS));
+    }
+
+    // Point in the plane, relative to the start, for a curve ending at d
+    xy_float_t point(const float t, const xy_float_t &d) const {
+      const float u = 1.0f - t;
+      return c1 * (3.0f * sq(u) * t) + c2 * (3.0f * u * sq(t)) + d * (sq(t) * t);
+    }
+  } block_curve_t;
+
+#endif
+
 #if ENABLED(AUTOTEMP)
   typedef struct {
     celsius_t min, max;
@@ -212,6 +253,7 @@ typedef struct PlannerBlock {
   bool is_sync() { return is_sync_pos() || is_sync_fan() || is_sync_pwr(); }
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
+  bool is_curve() { return TERN0(FTM_CURVES, flag.curve); }
 
   // Fields used by the motion planner to manage acceleration
   float nominal_speed,                      // The nominal speed for this block in (mm/sec)
@@ -252,7 +294,7 @@ typedef struct PlannerBlock {
     uint32_t acceleration_rate;             // Acceleration rate in (2^24 steps)/timer_ticks*s
   #endif
 
-  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is negative motion
+  AxisBits direction_bits;                  // Direction bits set for this block, where 1 is positive motion
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
@@ -271,6 +313,10 @@ typedef struct PlannerBlock {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(FTM_CURVES)
+    block_curve_t curve;                    // The curve followed by a curve block
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -318,6 +364,75 @@ constexpr uint8_t block_inc_mod(const uint8_t v1, const uint8_t v2) {
   #define BLOCK_MOD(n) ((n)%(BLOCK_BUFFER_SIZE))
 #endif
 
+#if ENABLED(TRAPEZOID_INTEGER_MATH)
+
+  /**
+   * Integer helpers for the trapezoid generator, for MCUs without an FPU.
+   * Rates are in steps/s, accelerations in steps/s^2 and distances in steps,
+   * so the results are exact and no fixed-point scaling is needed.
+   * 32-bit math is used whenever the rates are below 65536 steps/s.
+   */
+
+  // Integer square root, rounded down
+  template<typename T>
+  inline uint32_t trap_isqrt(T v) {
+    T res = 0, bit = T(1) << (sizeof(T) * 8 - 2);
+    while (bit > v) bit >>= 2;
+    while (bit) {
+      if (v >= res + bit) { v -= res + bit; res = (res >> 1) + bit; }
+      else res >>= 1;
+      bit >>= 2;
+    }
+    return uint32_t(res);
+  }
+
+  /**
+   * Steps to go from rate r0 to rate r1 (r1 >= r0) with the given acceleration,
+   * i.e., (r1^2 - r0^2) / (2 * accel), rounded down. The remainder is returned in 'rem'
+   * so callers can round up or combine two distances exactly.
+   */
+  inline uint32_t trap_accel_steps(const uint32_t r1, const uint32_t r0, const uint32_t accel, uint32_t &rem) {
+    const uint32_t accel_x2 = accel * 2;
+    if (r1 <= 0xFFFF) {
+      const uint32_t num = (r1 - r0) * (r1 + r0);
+      rem = num % accel_x2;
+      return num / accel_x2;
+    }
+    const uint64_t num = uint64_t(r1 - r0) * (r1 + r0);
+    rem = uint32_t(num % accel_x2);
+    return uint32_t(num / accel_x2);
+  }
+
+  // Rate reached after 'steps' steps, starting at rate r0 with the given acceleration
+  inline uint32_t trap_final_rate(const uint32_t r0, const uint32_t accel, const uint32_t steps) {
+    const uint64_t v = uint64_t(r0) * r0 + uint64_t(accel) * 2 * steps;
+    return v > UINT32_MAX ? trap_isqrt(v) : trap_isqrt(uint32_t(v));
+  }
+
+  /**
+   * Timer ticks to change the rate by 'dr' with the given acceleration,
+   * i.e., STEPPER_TIMER_RATE * dr / accel, rounded down. The fraction
+   * is a long division over the bits of the timer rate, so no 64-bit
+   * product or divide is needed.
+   */
+  inline uint32_t trap_accel_ticks(const uint32_t dr, const uint32_t accel) {
+    const uint32_t timer_rate = STEPPER_TIMER_RATE, r = dr % accel;
+    uint32_t q = 0, rem = 0, bit = _BV32(31);
+    while (!(timer_rate & bit)) bit >>= 1;
+    for (; bit; bit >>= 1) {
+      // Double the partial product, then add 'r' for each set bit, keeping rem < accel
+      q <<= 1; rem <<= 1;
+      if (rem >= accel) { rem -= accel; ++q; }
+      if (timer_rate & bit) {
+        rem += r;
+        if (rem >= accel) { rem -= accel; ++q; }
+      }
+    }
+    return (dr / accel) * timer_rate + q;
+  }
+
+#endif
+
 #if ENABLED(LASER_FEATURE)
   typedef struct {
     /**
@@ -416,6 +531,12 @@ struct PlannerHints {
                                       // would calculate if it knew the as-yet-unbuffered path
   #endif
 
+  #if ENABLED(FTM_CURVES)
+    const block_curve_t *curve = nullptr; // Curve to follow instead of a straight line
+  #endif
+  #if ENABLED(LEVELING_CORRECTION_STREAM)
+    bool leveled = false;             // Bed leveling was already applied to the target
+  #endif
   #if HAS_ROTATIONAL_AXES
     bool cartesian_move = true;       // True if linear motion of the tool centerpoint relative to the workpiece occurs.
                                       // False if no movement of the tool center point relative to the work piece occurs
@@ -812,6 +933,11 @@ class Planner {
     // Get count of movement slots free
     FORCE_INLINE static uint8_t moves_free() { return (BLOCK_BUFFER_SIZE) - 1 - movesplanned(); }
 
+    #if ENABLED(MPC_FEED_FORWARD)
+      // Average extrusion speed (mm/s) of the queued moves in the next 'seconds', or NAN if none are queued
+      static float planned_e_speed(const uint8_t extruder, const_float_t seconds);
+    #endif
+
     /**
      * Planner::get_next_free_block
      *
@@ -921,10 +1047,43 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if IS_KINEMATIC
+      /**
+       * Add a new linear movement to the buffer with the joint positions
+       * for the cartesian target already calculated, e.g., by interpolation.
+       *
+       *  cart         - target position in mm or degrees
+       *  joints       - joint positions for 'cart', with modifiers applied
+       *  fr_mm_s      - (target) speed of the move (mm/s)
+       *  extruder     - optional target extruder (otherwise active_extruder)
+       *  hints        - optional parameters to aid planner calculations
+       */
+      static bool buffer_kinematic_line(const xyze_pos_t &cart, const abce_pos_t &joints, const_feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
 
+    #if ENABLED(FTM_CURVES)
+      // Curve blocks can be queued while Fixed-Time Motion is on and leveling is off
+      static bool can_buffer_curves();
+
+      /**
+       * Add a cubic Bézier curve in the plane of axis_p and axis_q to the buffer as a single
+       * block, moving the other axes linearly. The control points c1 and c2 are relative to
+       * the start, which must be the current planner position.
+       * Return 'false' if the curve doesn't suit a single block and nothing was queued.
+       */
+      static bool buffer_curve(const xyze_pos_t &start, const xyze_pos_t &cart,
+        const xy_float_t &c1, const xy_float_t &c2, const AxisEnum axis_p, const AxisEnum axis_q,
+        const_feedRate_t fr_mm_s, const uint8_t extruder=active_extruder, const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -1081,14 +1240,17 @@ class Planner {
       }
     #endif
 
+    // Unit tests check the trapezoid of a block directly
+    friend class PlannerTest;
+
     static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed);
 
     static bool reverse_pass_kernel(block_t * const current, const block_t * const next, const_float_t safe_exit_speed_sqr);
     static void forward_pass_kernel(const block_t * const previous, block_t * const current);
 
-    static void reverse_pass(const_float_t safe_exit_speed_sqr);
+    static uint8_t reverse_pass(const_float_t safe_exit_speed_sqr);
 
-    static void recalculate_trapezoids(const_float_t safe_exit_speed_sqr);
+    static void recalculate_trapezoids(const_float_t safe_exit_speed_sqr, const uint8_t dirty_index);
 
     static void recalculate(const_float_t safe_exit_speed_sqr);
 
@@ -115,6 +115,16 @@ void cubic_b_spline(
   // Absolute first and second control points are recovered.
   const xy_pos_t first = position + offsets[0], second = target + offsets[1];
 
+  #if ENABLED(FTM_CURVES)
+    // With Fixed-Time Motion the whole curve can be a single block
+    if (planner.can_buffer_curves()) {
+      xyze_pos_t end = target;
+      apply_motion_limits(end);
+      if (planner.buffer_curve(position, end, offsets[0], second - position, X_AXIS, Y_AXIS, scaled_fr_mm_s, extruder))
+        return;
+    }
+  #endif
+
   xyze_pos_t bez_target;
   bez_target.set(position.x, position.y);
   float step = MAX_STEP;
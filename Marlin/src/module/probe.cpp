@@ -113,6 +113,11 @@ xyz_pos_t Probe::offset; // Initialized by settings.load()
   Probe::sense_bool_t Probe::test_sensitivity = { true, true, true };
 #endif
 
+#if ENABLED(PROBE_SWEEP)
+  bool Probe::sweeping; // = false
+  float Probe::sweep_backoff = Z_CLEARANCE_MULTI_PROBE;
+#endif
+
 #if ENABLED(Z_PROBE_SLED)
 
   #ifndef SLED_DOCKING_OFFSET
@@ -794,7 +799,7 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("1st Probe Z:", z1);
 
     // Raise to give the probe clearance
-    do_z_clearance(z1 + (Z_CLEARANCE_MULTI_PROBE), false);
+    do_z_clearance(z1 + TERN(PROBE_SWEEP, (sweeping ? sweep_backoff : Z_CLEARANCE_MULTI_PROBE), Z_CLEARANCE_MULTI_PROBE), false);
 
   #elif Z_PROBE_FEEDRATE_FAST != Z_PROBE_FEEDRATE_SLOW
 
@@ -887,6 +892,12 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("2nd Probe Z:", z2, " Discrepancy:", z1 - z2);
 
+    #if ENABLED(PROBE_SWEEP)
+      // The slow probe only has to clear the overshoot of the fast one.
+      // Back off a few times the discrepancy for the next point of the sweep.
+      if (sweeping) sweep_backoff = constrain(ABS(z1 - z2) * 4.0f + (PROBE_SWEEP_BACKOFF_MIN), PROBE_SWEEP_BACKOFF_MIN, Z_CLEARANCE_MULTI_PROBE);
+    #endif
+
     // Return a weighted average of the fast and slow probes
     const float measured_z = (z2 * 3.0f + z1 * 2.0f) * 0.2f;
 
@@ -922,6 +933,26 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/, const_float_t z_min_p
 
 #endif
 
+#if ENABLED(PROBE_SWEEP)
+
+  /**
+   * Start a sweep of probe points. Until sweep_end() the raise after each
+   * PROBE_PT_RAISE point is queued without waiting for it to finish, and the
+   * back-off for the slow probe adapts to the measured fast probe overshoot.
+   */
+  void Probe::sweep_start() {
+    sweeping = true;
+    sweep_backoff = Z_CLEARANCE_MULTI_PROBE;
+  }
+
+  void Probe::sweep_end() {
+    sweeping = false;
+    sweep_backoff = Z_CLEARANCE_MULTI_PROBE;
+    planner.synchronize();
+  }
+
+#endif
+
 /**
  * - Move to the given XY
  * - Deploy the probe, if not already deployed
@@ -1000,6 +1031,16 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
         case PROBE_PT_RAISE:
           if (raise_after_is_relative)
             do_z_clearance_by(z_clearance);
+          #if ENABLED(PROBE_SWEEP)
+            else if (sweeping) {
+              // Queue the raise without waiting. The move to the next point follows right behind it.
+              const float zdest = _MIN(z_clearance - _MIN(offset.z, 0.0f), Z_MAX_POS);
+              if (zdest > current_position.z) {
+                current_position.z = zdest;
+                line_to_current_position(z_probe_fast_mm_s);
+              }
+            }
+          #endif
           else
             do_z_clearance(z_clearance);
           break;
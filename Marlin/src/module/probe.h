@@ -342,6 +342,12 @@ public:
     static bool tare();
   #endif
 
+  #if ENABLED(PROBE_SWEEP)
+    // Bracket a run of probe_at_point calls, such as a G29 grid
+    static void sweep_start();
+    static void sweep_end();
+  #endif
+
   // Basic functions for Sensorless Homing and Probing
   #if HAS_DELTA_SENSORLESS_PROBING
     static void set_offset_sensorless_adj(const_float_t sz);
@@ -349,6 +355,11 @@ public:
   #endif
 
 private:
+  #if ENABLED(PROBE_SWEEP)
+    static bool sweeping;       // Queue the raise after each point without waiting
+    static float sweep_backoff; // Back-off from the fast touch for the slow probe
+  #endif
+
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
   static float run_z_probe(const bool sanity_check=true, const_float_t z_min_point=Z_PROBE_LOW_POINT, const_float_t z_clearance=Z_TWEEN_SAFE_CLEARANCE);
 };
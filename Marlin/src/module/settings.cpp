@@ -2298,7 +2298,10 @@ void MarlinSettings::postprocess() {
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          TERN_(THERMISTOR_DENSE_TABLE, thermalManager.dense_tables_dirty = true);
+        }
       }
       #endif
 
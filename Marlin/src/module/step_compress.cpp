@@ -0,0 +1,378 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_COMPRESSION)
+
+#include "step_compress.h"
+#include "stepper.h"
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "../feature/powerloss.h"
+#endif
+
+StepCompressor stepCompressor;
+
+// Timeline constants, in sub-ticks
+constexpr float subticks_per_s = float(STEPPER_TIMER_RATE) * _BV(STEP_COMPRESSION_SUBTICK_BITS);
+constexpr uint32_t slice_length = uint32_t(subticks_per_s * (STEP_COMPRESSION_LEAD_MS) / 4000),
+                   lead_length = slice_length * 4;
+constexpr int32_t max_error = int32_t(subticks_per_s * (STEP_COMPRESSION_MAX_ERROR) / 1000000);
+
+static_assert(lead_length < 0x40000000UL, "STEP_COMPRESSION_LEAD_MS is too long for this stepper timer.");
+
+// Longest time computed in float from one anchor step, in seconds
+constexpr float anchor_span_s = 0.05f;
+
+FORCE_INLINE uint64_t to_subticks(const float s) { return uint64_t(s * subticks_per_s + 0.5f); }
+
+volatile step_seq_t StepCompressor::queue[LOGICAL_AXES][STEP_COMPRESSION_QUEUE_SIZE];
+volatile uint8_t StepCompressor::queue_head[LOGICAL_AXES],
+                 StepCompressor::queue_tail[LOGICAL_AXES];
+step_run_t StepCompressor::run[LOGICAL_AXES];
+volatile uint32_t StepCompressor::now;
+volatile bool StepCompressor::hold,
+              StepCompressor::moving;
+
+block_t* StepCompressor::block; // = nullptr
+uint32_t StepCompressor::block_start,
+         StepCompressor::slice_end = slice_length;
+uint64_t StepCompressor::block_length,
+         StepCompressor::slice_offset;
+step_gen_t StepCompressor::gen[LOGICAL_AXES];
+float StepCompressor::r0, StepCompressor::r1, StepCompressor::accel, StepCompressor::cruise_rate,
+      StepCompressor::phase_events[3], StepCompressor::phase_rate[3];
+uint64_t StepCompressor::phase_start[3];
+#if HAS_MULTI_EXTRUDER
+  uint8_t StepCompressor::extruder, StepCompressor::seq_extruder;
+#endif
+
+/**
+ * Compress planner blocks into step sequences, working through the
+ * timeline one slice at a time. Called from idle().
+ */
+void StepCompressor::loop() {
+
+  // Drop everything on an endstop hit or quick stop.
+  // The ISR keeps purging its queues until the flag is cleared.
+  if (stepper.abort_current_block) {
+    if (block) {
+      // Planner::quick_stop() has already dropped all blocks, including this one.
+      // Only release it if it's still the planner's busy block.
+      if (planner.block_buffer_nonbusy != planner.block_buffer_tail) planner.release_current_block();
+      block = nullptr;
+    }
+    LOOP_LOGICAL_AXES(i) gen[i].pending = 0;
+    if (!isr_idle()) return;
+    hold = false;
+    stepper.abort_current_block = false;
+    return;
+  }
+
+  // The ISR ran out of steps, so start over on a fresh timeline
+  if (!hold && isr_idle()) restart_timeline();
+
+  for (;;) {
+
+    // Stay no more than the lead time ahead of the ISR
+    if (!hold && int32_t(slice_end - isr_now()) > int32_t(lead_length)) return;
+
+    if (!block && !next_block()) {
+      // Nothing more to compress for now, so send out the pending steps
+      if (flush() && !isr_idle()) hold = false;
+      return;
+    }
+
+    // Fill the slice for all axes. Let the ISR catch up if a queue is full.
+    bool ready = true;
+    LOOP_LOGICAL_AXES(i) if (!generate(i)) ready = false;
+    if (!ready) { hold = false; return; }
+
+    // Move to the next block once all its steps and time are used up
+    bool done = true;
+    LOOP_LOGICAL_AXES(i) if (gen[i].next < gen[i].steps) { done = false; break; }
+    if (done && block_length <= slice_offset) {
+      block_start += uint32_t(block_length);
+      block = nullptr;
+      planner.release_current_block();
+      continue;
+    }
+
+    // The slice is complete for all axes
+    if (!flush()) { hold = false; return; }
+    hold = false;
+    slice_end += slice_length;
+    slice_offset += slice_length;
+  }
+}
+
+bool StepCompressor::busy() {
+  if (block || !isr_idle()) return true;
+  LOOP_LOGICAL_AXES(i) if (gen[i].pending) return true;
+  return false;
+}
+
+uint32_t StepCompressor::isr_now() {
+  #ifdef __AVR__
+    const bool was_enabled = stepper.suspend();
+    const uint32_t t = now;
+    if (was_enabled) stepper.wake_up();
+    return t;
+  #else
+    return now;
+  #endif
+}
+
+// No queued sequences and no steps in progress. Check the queues first,
+// since the ISR sets 'moving' in the same call that pops a sequence.
+bool StepCompressor::isr_idle() {
+  LOOP_LOGICAL_AXES(i) if (queue_head[i] != queue_tail[i]) return false;
+  return !moving;
+}
+
+// Shift the timeline so the current slice starts at zero, and hold the ISR at zero.
+// Step times within the block are relative to its start, so they don't move.
+void StepCompressor::restart_timeline() {
+  const uint32_t origin = slice_end - slice_length;
+  bool pending = false;
+  LOOP_LOGICAL_AXES(i) {
+    step_gen_t &g = gen[i];
+    for (uint8_t j = 0; j < g.pending; ++j) g.times[j] -= origin;
+    if (g.pending) pending = true;
+  }
+  block_start = (block || pending) ? block_start - origin : 0;
+  slice_end = slice_length;
+
+  // The ISR doesn't advance the time while held, so it starts from zero
+  const bool was_enabled = stepper.suspend();
+  now = 0;
+  hold = true;
+  if (was_enabled) stepper.wake_up();
+}
+
+/**
+ * Get the next movement block from the planner, applying sync blocks
+ * once all earlier steps are done, and set up its velocity profile.
+ */
+bool StepCompressor::next_block() {
+  block_t *b;
+  while ((b = planner.get_current_block()) && b->is_sync()) {
+    if (b->is_sync_pos()) {
+      if (!flush() || !isr_idle()) return false;
+      const bool was_enabled = stepper.suspend();
+      stepper._set_position(b->position);
+      if (was_enabled) stepper.wake_up();
+    }
+    planner.release_current_block();
+  }
+  if (!b) return false;
+
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    recovery.info.sdpos = b->sdpos;
+    recovery.info.current_position = b->start_position;
+  #endif
+
+  #if ENABLED(Z_LATE_ENABLE)
+    if (b->steps.z) stepper.enable_axis(Z_AXIS);
+  #endif
+
+  block = b;
+  E_TERN_(extruder = b->extruder);
+
+  r0 = _MAX(b->initial_rate, uint32_t(1));
+  r1 = b->final_rate;
+  accel = b->acceleration_steps_per_s2;
+  const float accel_events = b->accelerate_before, decel_events = b->decelerate_start;
+  const bool cruise = b->decelerate_start > b->accelerate_before;
+  cruise_rate = cruise ? _MAX(b->nominal_rate, uint32_t(1)) : SQRT(sq(r0) + 2.0f * accel * accel_events);
+
+  // Each phase is timed from its own start, so float never spans the whole block
+  phase_events[0] = 0;
+  phase_events[1] = accel_events;
+  phase_events[2] = decel_events;
+  phase_rate[0] = r0;
+  phase_rate[1] = phase_rate[2] = cruise_rate;
+  phase_start[0] = 0;
+  phase_start[1] = to_subticks(2.0f * accel_events / (r0 + cruise_rate));
+  phase_start[2] = phase_start[1] + (cruise ? to_subticks((decel_events - accel_events) / cruise_rate) : 0);
+  block_length = phase_start[2] + to_subticks(2.0f * (b->step_event_count - decel_events) / (cruise_rate + rate_at(b->step_event_count)));
+
+  // The block starts within the slice being filled
+  slice_offset = slice_end - block_start;
+
+  LOOP_LOGICAL_AXES(i) {
+    step_gen_t &g = gen[i];
+    g.steps = b->steps[i];
+    g.next = 0;
+    g.phase = 0xFF;     // No anchor step yet
+    g.timed = false;
+    g.dir = b->direction_bits[i];
+  }
+
+  return true;
+}
+
+// Step event rate at the given step event position
+float StepCompressor::rate_at(const float events) {
+  if (events <= phase_events[1]) return SQRT(sq(r0) + 2.0f * accel * events);
+  if (events <= phase_events[2]) return cruise_rate;
+  return SQRT(_MAX(sq(cruise_rate) - 2.0f * accel * (events - phase_events[2]), sq(r1)));
+}
+
+/**
+ * Time of step 'next' of an axis from the block start, in sub-ticks.
+ * Under constant acceleration the time between two positions is twice the
+ * distance over the sum of the rates. Each step is timed from an anchor step
+ * in the same phase, or from the phase start, so float only spans a short time.
+ */
+uint64_t StepCompressor::step_time(step_gen_t &g, const float events_per_step) {
+  const float events = (g.next + 0.5f) * events_per_step,
+              rate = rate_at(events);
+  const uint8_t phase = events <= phase_events[1] ? 0 : events <= phase_events[2] ? 1 : 2;
+  const bool new_phase = phase != g.phase;
+
+  const float span = new_phase ? events - phase_events[phase] : (g.next - g.anchor) * events_per_step,
+              dt = 2.0f * span / ((new_phase ? phase_rate[phase] : g.anchor_rate) + rate);
+  const uint64_t t = (new_phase ? phase_start[phase] : g.anchor_time) + to_subticks(dt);
+
+  if (new_phase || dt >= anchor_span_s) {
+    g.phase = phase;
+    g.anchor = g.next;
+    g.anchor_time = t;
+    g.anchor_rate = rate;
+  }
+  return t;
+}
+
+/**
+ * Add the step times of an axis up to the end of the slice or block.
+ * Steps are spread evenly over the block's step events.
+ * Return false if the axis queue filled up first.
+ */
+bool StepCompressor::generate(const uint8_t a) {
+  step_gen_t &g = gen[a];
+  if (g.next >= g.steps) return true;
+
+  // A direction or E stepper change ends the pending sequence
+  if (g.pending && (g.seq_dir != g.dir E_TERN_(|| (a == E_AXIS && seq_extruder != extruder))) && !compress(a, true))
+    return false;
+
+  const float events_per_step = float(block->step_event_count) / g.steps;
+  do {
+    if (g.pending == STEP_COMPRESSION_WINDOW && !compress(a, false)) return false;
+
+    if (!g.timed) {
+      g.time = step_time(g, events_per_step);
+      g.timed = true;
+    }
+    if (g.time >= slice_offset) break; // Belongs to a later slice
+
+    if (!g.pending) {
+      g.seq_dir = g.dir;
+      E_TERN_(if (a == E_AXIS) seq_extruder = extruder);
+    }
+    g.times[g.pending++] = block_start + uint32_t(g.time);
+    g.timed = false;
+  } while (++g.next < g.steps);
+
+  return true;
+}
+
+/**
+ * Find the longest run of pending steps that one sequence can reproduce
+ * within max_error. The first two steps are exact and 'add' is chosen
+ * to land the last step on time. Pending times span at most one slice.
+ */
+uint16_t StepCompressor::fit(const step_gen_t &g, uint32_t &interval, int32_t &add) {
+  if (g.pending < 2) { interval = add = 0; return g.pending; }
+
+  const int32_t iv = _MAX(int32_t(g.times[1] - g.times[0]), int32_t(1));
+
+  auto fits = [&](const uint8_t n, int32_t &A) {
+    A = 0;
+    if (n < 3) return true;
+    const int64_t span = int32_t(g.times[n - 1] - g.times[0]),
+                  num = 2 * (span - int64_t(n - 1) * iv),
+                  den = int64_t(n - 1) * (n - 2);
+    A = int32_t((num + (num < 0 ? -den : den) / 2) / den);
+    if (iv + int64_t(A) * (n - 2) < 1) return false;  // Intervals must stay positive
+    int64_t t = 0, i = iv;
+    for (uint8_t j = 1; j < n; ++j, i += A) {
+      t += i;
+      const int64_t err = t - int32_t(g.times[j] - g.times[0]);
+      if (err > max_error || err < -max_error) return false;
+    }
+    return true;
+  };
+
+  uint8_t lo = 2, hi = g.pending;
+  int32_t best = 0, A;
+  if (fits(hi, A)) { lo = hi; best = A; }
+  else while (hi - lo > 1) {
+    const uint8_t mid = (lo + hi) / 2;
+    if (fits(mid, A)) { lo = mid; best = A; } else hi = mid;
+  }
+
+  interval = iv;
+  add = best;
+  return lo;
+}
+
+/**
+ * Emit sequences for the pending step times of an axis: all of them,
+ * or just one to make room. Return false if the queue is full.
+ */
+bool StepCompressor::compress(const uint8_t a, const bool all) {
+  step_gen_t &g = gen[a];
+  while (g.pending) {
+    const uint8_t h = queue_head[a], next_h = (h + 1) & (STEP_COMPRESSION_QUEUE_SIZE - 1);
+    if (next_h == queue_tail[a]) return false;
+
+    uint32_t interval;
+    int32_t add;
+    const uint16_t n = fit(g, interval, add);
+
+    volatile step_seq_t &s = queue[a][h];
+    s.start = g.times[0];
+    s.interval = interval;
+    s.add = add;
+    s.count = n;
+    s.dir = g.seq_dir;
+    E_TERN_(s.extruder = seq_extruder);
+    queue_head[a] = next_h;
+
+    g.pending -= n;
+    memmove(g.times, g.times + n, g.pending * sizeof(g.times[0]));
+    if (!all) break;
+  }
+  return true;
+}
+
+// Emit all pending step times. Return false if any queue is full.
+bool StepCompressor::flush() {
+  bool ok = true;
+  LOOP_LOGICAL_AXES(i) if (!compress(i, true)) ok = false;
+  return ok;
+}
+
+#endif // STEP_COMPRESSION
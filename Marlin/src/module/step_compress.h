@@ -0,0 +1,155 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * step_compress.h - Step sequences precomputed by the main loop
+ *
+ * Planner blocks are turned into the ideal time of every step of every axis,
+ * and runs of steps are compressed into (start, interval, count, add) sequences.
+ * The Stepper ISR only has to pop the sequences and pulse the pins.
+ *
+ * All times share one timeline in 1/256 timer tick units ("sub-ticks") so long
+ * sequences don't accumulate rounding error. The main loop works through the
+ * timeline in short slices, completing each slice for all axes before moving
+ * on, and stays no more than STEP_COMPRESSION_LEAD_MS ahead of the ISR.
+ *
+ * The 32-bit timeline wraps every few seconds, so only times within a slice or
+ * two of the ISR are kept on it. Step times within a block are kept in 64 bits
+ * from the block start until their slice comes up.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "planner.h"
+
+#define STEP_COMPRESSION_SUBTICK_BITS 8
+#define STEP_COMPRESSION_IDLE_TICKS ((STEPPER_TIMER_RATE) / 1000) // ISR interval while there's nothing to step
+
+typedef struct {
+  uint32_t start;       // Time of the first step
+  uint32_t interval;    // Time from the first to the second step
+  int32_t add;          // Added to the interval after each step
+  uint16_t count;       // Number of steps in the sequence
+  bool dir;             // Direction of the steps
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;   // E stepper for E axis sequences
+  #endif
+} step_seq_t;
+
+typedef struct {
+  uint32_t next;        // Time of the next step
+  uint32_t interval;    // Time from the next step to the one after
+  int32_t add;
+  uint16_t count;       // Steps left in the active sequence
+  bool dir;
+  #if HAS_MULTI_EXTRUDER
+    uint8_t extruder;
+  #endif
+} step_run_t;
+
+typedef struct {
+  uint32_t steps,       // Steps for this axis in the current block
+           next,        // Index of the next step to generate
+           anchor;      // Index of the step that later steps are timed from
+  uint64_t time,        // Time of step 'next' from the block start, once computed
+           anchor_time; // Time of the anchor step from the block start
+  float anchor_rate;    // Step event rate at the anchor step
+  uint8_t phase;        // Acceleration phase of the anchor step
+  bool timed,           // 'time' is valid
+       dir,             // Direction in the current block
+       seq_dir;         // Direction of the pending step times
+  uint8_t pending;      // Step times waiting to be compressed
+  uint32_t times[STEP_COMPRESSION_WINDOW];
+} step_gen_t;
+
+class StepCompressor {
+
+  public:
+
+    // Shared with the Stepper ISR
+    static volatile step_seq_t queue[LOGICAL_AXES][STEP_COMPRESSION_QUEUE_SIZE]; // Compressed step sequences for each axis
+    static volatile uint8_t queue_head[LOGICAL_AXES],   // Next sequence to write (main loop)
+                            queue_tail[LOGICAL_AXES];   // Next sequence to read (ISR)
+    static step_run_t run[LOGICAL_AXES];                // Sequences being stepped by the ISR
+    static volatile uint32_t now;                       // ISR position on the timeline
+    static volatile bool hold,                          // Set while a new timeline is being prepared
+                         moving;                        // The ISR has steps in progress
+
+    static void loop();                                 // Compress planner blocks. Called from idle().
+    static bool busy();                                 // Steps remain to be compressed or executed
+
+    // Start the next sequence for an axis. Called from the Stepper ISR.
+    static bool load(const uint8_t a) {
+      const uint8_t t = queue_tail[a];
+      if (t == queue_head[a]) return false;
+      const volatile step_seq_t &s = queue[a][t];
+      step_run_t &r = run[a];
+      r.next = s.start;
+      r.interval = s.interval;
+      r.add = s.add;
+      r.dir = s.dir;
+      E_TERN_(r.extruder = s.extruder);
+      r.count = s.count;
+      queue_tail[a] = (t + 1) & (STEP_COMPRESSION_QUEUE_SIZE - 1);
+      return true;
+    }
+
+    // Drop all queued and active sequences. Called from the Stepper ISR.
+    static void purge() {
+      LOOP_LOGICAL_AXES(i) { queue_tail[i] = queue_head[i]; run[i].count = 0; }
+      moving = false;
+    }
+
+  private:
+
+    static block_t *block;                  // The block being compressed
+    static uint32_t block_start,            // Time at the start of the block
+                    slice_end;              // End of the timeline slice being filled
+    static uint64_t block_length,           // Duration of the block
+                    slice_offset;           // Time from the block start to the end of the slice
+    static step_gen_t gen[LOGICAL_AXES];
+
+    // Trapezoid of the current block, in step events and step events per second
+    static float r0, r1, accel, cruise_rate;
+
+    // Step event position, time from the block start, and rate at the start of each phase
+    static float phase_events[3], phase_rate[3];
+    static uint64_t phase_start[3];
+
+    #if HAS_MULTI_EXTRUDER
+      static uint8_t extruder,              // E stepper of the current block
+                     seq_extruder;          // E stepper of the pending E step times
+    #endif
+
+    static uint32_t isr_now();
+    static bool isr_idle();
+    static bool next_block();
+    static float rate_at(const float events);
+    static uint64_t step_time(step_gen_t &g, const float events_per_step);
+    static bool generate(const uint8_t a);
+    static uint16_t fit(const step_gen_t &g, uint32_t &interval, int32_t &add);
+    static bool compress(const uint8_t a, const bool all);
+    static bool flush();
+    static void restart_timeline();
+};
+
+extern StepCompressor stepCompressor;
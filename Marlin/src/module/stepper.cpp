@@ -102,6 +102,10 @@ Stepper stepper; // Singleton
   #include "ft_motion.h"
 #endif
 
+#if ENABLED(STEP_COMPRESSION)
+  #include "step_compress.h"
+#endif
+
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
 #include "../sd/cardreader.h"
@@ -152,6 +156,12 @@ Stepper stepper; // Singleton
   #include "../HAL/ESP32/i2s.h"
 #endif
 
+#if ENABLED(STEPPER_ISR_PROFILER)
+  #include "../feature/isr_profiler.h"
+#else
+  #define ISR_PROFILE(P, F) F
+#endif
+
 // public:
 
 #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -1511,8 +1521,16 @@ HAL_STEP_TIMER_ISR() {
 
 void Stepper::isr() {
 
+  #if ENABLED(PLANNER_BENCHMARK)
+    // The Planner Benchmark consumes blocks from idle(), so just keep the timer alive
+    HAL_timer_set_compare(MF_TIMER_STEP, hal_timer_t(HAL_timer_get_count(MF_TIMER_STEP) + (STEPPER_TIMER_RATE) / 1000));
+    return;
+  #endif
+
   static hal_timer_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
+  TERN_(STEPPER_ISR_PROFILER, const isr_ticks_t isr_profile_start = IsrProfiler::now());
+
   #ifndef __AVR__
     // Disable interrupts, to avoid ISR preemption while we reprogram the period
     // (AVR enters the ISR with global interrupts disabled, so no need to do it here)
@@ -1549,7 +1567,7 @@ void Stepper::isr() {
       if (using_ftMotion) {
         if (!nextMainISR) {               // Main ISR is ready to fire during this iteration?
           nextMainISR = FTM_MIN_TICKS;    // Set to minimum interval (a limit on the top speed)
-          ftMotion_stepper();             // Run FTM Stepping
+          ISR_PROFILE(FT_MOTION, ftMotion_stepper()); // Run FTM Stepping
         }
 
         #if ENABLED(BABYSTEPPING)
@@ -1569,15 +1587,36 @@ void Stepper::isr() {
 
     #endif
 
-    if (!using_ftMotion) {
+    #if ENABLED(STEP_COMPRESSION)
 
-      TERN_(HAS_ZV_SHAPING, shaping_isr());               // Do Shaper stepping, if needed
+      if (!nextMainISR) ISR_PROFILE(PULSE_PHASE, nextMainISR = compressed_step_isr()); // Pulse the precomputed steps
 
-      if (!nextMainISR) pulse_phase_isr();                // 0 = Do coordinated axes Stepper pulses
+      #if ENABLED(BABYSTEPPING)
+        if (nextBabystepISR == 0) {                     // Avoid ANY stepping too soon after baby-stepping
+          nextBabystepISR = babystepping_isr();
+          NOLESS(nextMainISR, (BABYSTEP_TICKS) / 8);    // FULL STOP for 125µs after a baby-step
+        }
+        if (nextBabystepISR != BABYSTEP_NEVER)          // Avoid baby-stepping too close to axis Stepping
+          NOLESS(nextBabystepISR, nextMainISR / 2);
+      #endif
+
+      interval = nextMainISR;                           // Time until the next step of any axis
+      TERN_(BABYSTEPPING, NOMORE(interval, nextBabystepISR)); // Come back early for Babystepping?
+
+      nextMainISR -= interval;
+      TERN_(BABYSTEPPING, if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval);
+
+    #endif
+
+    if (!using_ftMotion && DISABLED(STEP_COMPRESSION)) {
+
+      TERN_(HAS_ZV_SHAPING, ISR_PROFILE(SHAPING, shaping_isr())); // Do Shaper stepping, if needed
+
+      if (!nextMainISR) ISR_PROFILE(PULSE_PHASE, pulse_phase_isr()); // 0 = Do coordinated axes Stepper pulses
 
       #if ENABLED(LIN_ADVANCE)
         if (!nextAdvanceISR) {                            // 0 = Do Linear Advance E Stepper pulses
-          advance_isr();
+          ISR_PROFILE(ADVANCE, advance_isr());
           nextAdvanceISR = la_interval;
         }
         else if (nextAdvanceISR > la_interval)            // Start/accelerate LA steps if necessary
@@ -1591,7 +1630,7 @@ void Stepper::isr() {
 
       // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-      if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+      if (!nextMainISR) ISR_PROFILE(BLOCK_PHASE, nextMainISR = block_phase_isr()); // Manage acc/deceleration, get next block
 
       #if ENABLED(BABYSTEPPING)
         if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1709,6 +1748,8 @@ void Stepper::isr() {
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
 
+  TERN_(STEPPER_ISR_PROFILER, isr_profiler.record(IsrProfiler::ISR_TOTAL, isr_profile_start));
+
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, next_isr_ticks);
 
@@ -1868,7 +1909,6 @@ void Stepper::pulse_phase_isr() {
                  if ((VALUE) <  7) dm[_AXIS(AXIS)] = false; \
             else if ((VALUE) >  7) dm[_AXIS(AXIS)] = true;  \
             page_step_state.sd[_AXIS(AXIS)] = VALUE;        \
-            page_step_state.bd[_AXIS(AXIS)] += VALUE;       \
           }while(0)
 
           #define PAGE_PULSE_PREP(AXIS) do{ \
@@ -1908,8 +1948,7 @@ void Stepper::pulse_phase_isr() {
         #elif STEPPER_PAGE_FORMAT == SP_4x2_256
 
           #define PAGE_SEGMENT_UPDATE(AXIS, VALUE) \
-            page_step_state.sd[_AXIS(AXIS)] = VALUE; \
-            page_step_state.bd[_AXIS(AXIS)] += VALUE;
+            page_step_state.sd[_AXIS(AXIS)] = VALUE;
 
           #define PAGE_PULSE_PREP(AXIS) do{ \
             step_needed.set(_AXIS(AXIS), \
@@ -1942,8 +1981,6 @@ void Stepper::pulse_phase_isr() {
 
           #define PAGE_PULSE_PREP(AXIS, NBIT) do{            \
             step_needed.set(_AXIS(AXIS), TEST(steps, NBIT)); \
-            if (step_needed.test(_AXIS(AXIS)))               \
-              page_step_state.bd[_AXIS(AXIS)]++;             \
           }while(0)
 
           uint8_t steps = page_step_state.page[page_step_state.segment_idx >> 1];
@@ -2411,23 +2448,6 @@ hal_timer_t Stepper::block_phase_isr() {
   if (current_block) {
     // If current block is finished, reset pointer and finalize state
     if (step_events_completed >= step_event_count) {
-      #if ENABLED(DIRECT_STEPPING)
-        // Direct stepping is currently not ready for HAS_I_AXIS
-        #if STEPPER_PAGE_FORMAT == SP_4x4D_128
-          #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
-            count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] - 128 * 7;
-        #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || STEPPER_PAGE_FORMAT == SP_4x2_256
-          #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
-            count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] * count_direction[_AXIS(AXIS)];
-        #endif
-
-        if (current_block->is_page()) {
-          PAGE_SEGMENT_UPDATE_POS(X);
-          PAGE_SEGMENT_UPDATE_POS(Y);
-          PAGE_SEGMENT_UPDATE_POS(Z);
-          PAGE_SEGMENT_UPDATE_POS(E);
-        }
-      #endif
       TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
       discard_current_block();
     }
@@ -2679,7 +2699,6 @@ hal_timer_t Stepper::block_phase_isr() {
           page_step_state.segment_steps = 0;
           page_step_state.segment_idx = 0;
           page_step_state.page = page_manager.get_page(current_block->page_idx);
-          page_step_state.bd.reset();
 
           if (DirectStepping::Config::DIRECTIONAL)
             current_block->direction_bits = last_direction_bits;
@@ -3729,6 +3748,92 @@ void Stepper::report_positions() {
 
 #endif // FT_MOTION
 
+#if ENABLED(STEP_COMPRESSION)
+
+  /**
+   * Pulse every axis whose next precomputed step is due, then return the
+   * ticks until the next step of any axis. Sequence times are in sub-ticks
+   * on the StepCompressor timeline, which advances by the returned ticks.
+   */
+  hal_timer_t Stepper::compressed_step_isr() {
+
+    // On an abort keep dropping steps until the main loop has cleaned up
+    if (abort_current_block) {
+      StepCompressor::purge();
+      axis_did_move.reset();
+      return STEP_COMPRESSION_IDLE_TICKS;
+    }
+
+    // Wait while a new timeline is prepared. The time stays at zero until it starts.
+    if (StepCompressor::hold) return STEP_COMPRESSION_IDLE_TICKS;
+
+    if (TERN0(FREEZE_FEATURE, frozen)) return STEP_COMPRESSION_IDLE_TICKS;
+
+    const uint32_t now = StepCompressor::now;
+    step_run_t * const run = StepCompressor::run;
+
+    // Find the axes with a step due
+    AxisFlags step_needed{0};
+    AxisBits dir_bits = last_direction_bits;
+    LOOP_LOGICAL_AXES(i) {
+      step_run_t &r = run[i];
+      if ((r.count || StepCompressor::load(i)) && int32_t(r.next - now) <= 0) {
+        step_needed.set(i);
+        dir_bits.bset(AxisEnum(i), r.dir);
+      }
+    }
+
+    if (step_needed) {
+      bool new_extruder = false;
+      #if HAS_MULTI_EXTRUDER
+        if (step_needed.test(E_AXIS) && run[E_AXIS].extruder != stepper_extruder) {
+          stepper_extruder = last_moved_extruder = run[E_AXIS].extruder;
+          new_extruder = true;
+        }
+      #endif
+      if (new_extruder || dir_bits != last_direction_bits) set_directions(dir_bits);
+
+      USING_TIMED_PULSE();
+
+      #define _SC_PULSE_START(A) if (step_needed.test(_AXIS(A))) A##_APPLY_STEP(STEP_STATE_##A, false);
+      LOGICAL_AXIS_MAP(_SC_PULSE_START);
+
+      START_TIMED_PULSE();
+
+      // Count the steps and advance the sequences while the pulses are high
+      LOOP_LOGICAL_AXES(i) if (step_needed.test(i)) {
+        step_run_t &r = run[i];
+        count_position[i] += r.dir ? 1 : -1;
+        if (--r.count) { r.next += r.interval; r.interval += r.add; }
+        else StepCompressor::load(i);
+      }
+
+      AWAIT_HIGH_PULSE();
+
+      #define _SC_PULSE_STOP(A) if (step_needed.test(_AXIS(A))) A##_APPLY_STEP(!STEP_STATE_##A, false);
+      LOGICAL_AXIS_MAP(_SC_PULSE_STOP);
+    }
+
+    // Sleep until the next step of any axis
+    int32_t wait = INT32_MAX;
+    AxisBits moving_bits;
+    LOOP_LOGICAL_AXES(i) if (run[i].count) {
+      moving_bits.bset(AxisEnum(i));
+      NOMORE(wait, int32_t(run[i].next - now));
+    }
+    axis_did_move = moving_bits;
+    StepCompressor::moving = bool(moving_bits);
+
+    hal_timer_t ticks = STEP_COMPRESSION_IDLE_TICKS;
+    if (moving_bits)
+      ticks = wait <= 0 ? 1 : _MIN((uint32_t(wait) + _BV(STEP_COMPRESSION_SUBTICK_BITS) - 1) >> STEP_COMPRESSION_SUBTICK_BITS, uint32_t(HAL_TIMER_TYPE_MAX));
+
+    StepCompressor::now = now + (uint32_t(ticks) << STEP_COMPRESSION_SUBTICK_BITS);
+    return ticks;
+  }
+
+#endif // STEP_COMPRESSION
+
 #if ENABLED(BABYSTEPPING)
 
   #define _ENABLE_AXIS(A) enable_axis(_AXIS(A))
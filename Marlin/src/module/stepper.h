@@ -291,6 +291,7 @@ constexpr ena_mask_t enable_overlap[] = {
 class Stepper {
   friend class Max7219;
   friend class FTMotion;
+  friend class StepCompressor;
   friend void stepperTask(void *);
 
   public:
@@ -706,6 +707,10 @@ class Stepper {
       static void ftMotion_stepper();
     #endif
 
+    #if ENABLED(STEP_COMPRESSION)
+      static hal_timer_t compressed_step_isr();
+    #endif
+
 };
 
 extern Stepper stepper;
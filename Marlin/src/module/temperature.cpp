@@ -1652,6 +1652,10 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
         ambient_xfer_coeff += fan_fraction * mpc.fan255_adjustment;
       #endif
 
+      #if ENABLED(MPC_FEED_FORWARD)
+        float planned_xfer_coeff = ambient_xfer_coeff; // Heat transfer expected over the moves ahead
+      #endif
+
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
         const float e_speed = (e_position - MPC::e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
@@ -1663,6 +1667,17 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
           if (!MPC::e_paused) ambient_xfer_coeff += e_speed * mpc.filament_heat_capacity_permm;
           MPC::e_position = e_position;
         }
+
+        #if ENABLED(MPC_FEED_FORWARD)
+          // Heat for the extrusion rate of the planned moves. The block heats up ahead
+          // of fast extrusion and eases off ahead of travel. With no moves queued use
+          // the current extrusion rate.
+          const float planned_e_speed = planner.planned_e_speed(active_extruder, MPC_FEED_FORWARD_TIME);
+          if (MPC::e_paused || isnan(planned_e_speed))
+            planned_xfer_coeff = ambient_xfer_coeff;
+          else
+            planned_xfer_coeff += planned_e_speed * mpc.filament_heat_capacity_permm;
+        #endif
       }
 
       // Update the modeled temperatures
@@ -1687,7 +1702,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id OPTARG(ERR_INCLUDE_T
       if (hotend.target != 0 && !is_idling) {
         // Plan power level to get to target temperature in 2 seconds
         power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
-        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
+        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * TERN(MPC_FEED_FORWARD, planned_xfer_coeff, ambient_xfer_coeff);
       }
 
       float pid_output = power * 254.0f / mpc.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
@@ -2224,6 +2239,32 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+#if ENABLED(THERMISTOR_DENSE_TABLE)
+
+  #if HAS_HOTEND
+    DenseThermistorTable Temperature::dense_hotend[HOTENDS];
+  #endif
+  #if HAS_DENSE_BED
+    DenseThermistorTable Temperature::dense_bed;
+  #endif
+  #if HAS_DENSE_CHAMBER
+    DenseThermistorTable Temperature::dense_chamber;
+  #endif
+  bool Temperature::dense_tables_dirty = true;
+
+  // Sample the exact conversions for every table. Needed again when a custom thermistor changes.
+  void Temperature::build_dense_tables() {
+    #if HAS_HOTEND
+      HOTEND_LOOP() if (TEST(dense_hotends, e))
+        dense_hotend[e].build([e](const raw_adc_t raw) { return analog_to_celsius_hotend(raw, e); });
+    #endif
+    TERN_(HAS_DENSE_BED, dense_bed.build(analog_to_celsius_bed));
+    TERN_(HAS_DENSE_CHAMBER, dense_chamber.build(analog_to_celsius_chamber));
+    dense_tables_dirty = false;
+  }
+
+#endif // THERMISTOR_DENSE_TABLE
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2274,6 +2315,7 @@ void Temperature::task() {
       #endif
     };
     COPY(user_thermistor, default_user_thermistor);
+    TERN_(THERMISTOR_DENSE_TABLE, dense_tables_dirty = true);
   }
 
   void Temperature::M305_report(const uint8_t t_index, const bool forReplay/*=true*/) {
@@ -2643,12 +2685,39 @@ void Temperature::updateTemperaturesFromRawValues() {
     temp_bed.setraw(read_max_tc_bed());
   #endif
 
-  #if HAS_HOTEND
-    HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].getraw(), e);
+  #if ENABLED(THERMISTOR_DENSE_TABLE)
+
+    if (dense_tables_dirty) build_dense_tables();
+
+    #if HAS_HOTEND
+      HOTEND_LOOP() {
+        const raw_adc_t raw = temp_hotend[e].getraw();
+        temp_hotend[e].celsius = TEST(dense_hotends, e) ? dense_hotend[e].celsius(raw) : analog_to_celsius_hotend(raw, e);
+      }
+    #endif
+
+    #if HAS_DENSE_BED
+      temp_bed.celsius = dense_bed.celsius(temp_bed.getraw());
+    #elif HAS_HEATED_BED
+      temp_bed.celsius = analog_to_celsius_bed(temp_bed.getraw());
+    #endif
+    #if HAS_DENSE_CHAMBER
+      temp_chamber.celsius = dense_chamber.celsius(temp_chamber.getraw());
+    #elif HAS_TEMP_CHAMBER
+      temp_chamber.celsius = analog_to_celsius_chamber(temp_chamber.getraw());
+    #endif
+
+  #else
+
+    #if HAS_HOTEND
+      HOTEND_LOOP() temp_hotend[e].celsius = analog_to_celsius_hotend(temp_hotend[e].getraw(), e);
+    #endif
+
+    TERN_(HAS_HEATED_BED,     temp_bed.celsius       = analog_to_celsius_bed(temp_bed.getraw()));
+    TERN_(HAS_TEMP_CHAMBER,   temp_chamber.celsius   = analog_to_celsius_chamber(temp_chamber.getraw()));
+
   #endif
 
-  TERN_(HAS_HEATED_BED,     temp_bed.celsius       = analog_to_celsius_bed(temp_bed.getraw()));
-  TERN_(HAS_TEMP_CHAMBER,   temp_chamber.celsius   = analog_to_celsius_chamber(temp_chamber.getraw()));
   TERN_(HAS_TEMP_COOLER,    temp_cooler.celsius    = analog_to_celsius_cooler(temp_cooler.getraw()));
   TERN_(HAS_TEMP_PROBE,     temp_probe.celsius     = analog_to_celsius_probe(temp_probe.getraw()));
   TERN_(HAS_TEMP_BOARD,     temp_board.celsius     = analog_to_celsius_board(temp_board.getraw()));
@@ -3648,50 +3717,62 @@ void Temperature::pause_heaters(const bool p) {
 
 #endif // TEMP_SENSOR_IS_MAX_TC(BED)
 
+#if ENABLED(CONTINUOUS_ADC_SAMPLING)
+  // The HAL's oversampled reading for a pin, scaled to OVERSAMPLENR samples
+  static raw_adc_t adc_oversampled(const pin_t pin) {
+    const uint32_t sum = hal.adc_oversampled(pin);
+    return raw_adc_t((OVERSAMPLENR) == (HAL_ADC_OVERSAMPLE) ? sum : sum * (OVERSAMPLENR) / (HAL_ADC_OVERSAMPLE));
+  }
+  #define UPDATE_RAW(T,P) T.setraw(adc_oversampled(P))
+#else
+  #define UPDATE_RAW(T,P) T.update()
+#endif
+
 /**
  * Update raw temperatures
  *
  * Called by ISR => readings_ready when new temperatures have been set by updateTemperaturesFromRawValues.
  * Applies all the accumulators to the current raw temperatures.
+ * With CONTINUOUS_ADC_SAMPLING the HAL's oversampled readings are used instead.
  */
 void Temperature::update_raw_temperatures() {
 
   // TODO: can this be collapsed into a HOTEND_LOOP()?
   #if HAS_TEMP_ADC_0 && !TEMP_SENSOR_IS_MAX_TC(0)
-    temp_hotend[0].update();
+    UPDATE_RAW(temp_hotend[0], TEMP_0_PIN);
   #endif
 
   #if HAS_TEMP_ADC_1 && !TEMP_SENSOR_IS_MAX_TC(1)
-    temp_hotend[1].update();
+    UPDATE_RAW(temp_hotend[1], TEMP_1_PIN);
   #endif
 
   #if HAS_TEMP_ADC_2 && !TEMP_SENSOR_IS_MAX_TC(2)
-    temp_hotend[2].update();
+    UPDATE_RAW(temp_hotend[2], TEMP_2_PIN);
   #endif
 
   #if HAS_TEMP_ADC_REDUNDANT && !TEMP_SENSOR_IS_MAX_TC(REDUNDANT)
-    temp_redundant.update();
+    UPDATE_RAW(temp_redundant, TEMP_REDUNDANT_PIN);
   #endif
 
   #if HAS_TEMP_ADC_BED && !TEMP_SENSOR_IS_MAX_TC(BED)
-    temp_bed.update();
+    UPDATE_RAW(temp_bed, TEMP_BED_PIN);
   #endif
 
-  TERN_(HAS_TEMP_ADC_2,       temp_hotend[2].update());
-  TERN_(HAS_TEMP_ADC_3,       temp_hotend[3].update());
-  TERN_(HAS_TEMP_ADC_4,       temp_hotend[4].update());
-  TERN_(HAS_TEMP_ADC_5,       temp_hotend[5].update());
-  TERN_(HAS_TEMP_ADC_6,       temp_hotend[6].update());
-  TERN_(HAS_TEMP_ADC_7,       temp_hotend[7].update());
-  TERN_(HAS_TEMP_ADC_CHAMBER, temp_chamber.update());
-  TERN_(HAS_TEMP_ADC_PROBE,   temp_probe.update());
-  TERN_(HAS_TEMP_ADC_COOLER,  temp_cooler.update());
-  TERN_(HAS_TEMP_ADC_BOARD,   temp_board.update());
-  TERN_(HAS_TEMP_ADC_SOC,     temp_soc.update());
-
-  TERN_(HAS_JOY_ADC_X, joystick.x.update());
-  TERN_(HAS_JOY_ADC_Y, joystick.y.update());
-  TERN_(HAS_JOY_ADC_Z, joystick.z.update());
+  TERN_(HAS_TEMP_ADC_2,       UPDATE_RAW(temp_hotend[2], TEMP_2_PIN));
+  TERN_(HAS_TEMP_ADC_3,       UPDATE_RAW(temp_hotend[3], TEMP_3_PIN));
+  TERN_(HAS_TEMP_ADC_4,       UPDATE_RAW(temp_hotend[4], TEMP_4_PIN));
+  TERN_(HAS_TEMP_ADC_5,       UPDATE_RAW(temp_hotend[5], TEMP_5_PIN));
+  TERN_(HAS_TEMP_ADC_6,       UPDATE_RAW(temp_hotend[6], TEMP_6_PIN));
+  TERN_(HAS_TEMP_ADC_7,       UPDATE_RAW(temp_hotend[7], TEMP_7_PIN));
+  TERN_(HAS_TEMP_ADC_CHAMBER, UPDATE_RAW(temp_chamber, TEMP_CHAMBER_PIN));
+  TERN_(HAS_TEMP_ADC_PROBE,   UPDATE_RAW(temp_probe, TEMP_PROBE_PIN));
+  TERN_(HAS_TEMP_ADC_COOLER,  UPDATE_RAW(temp_cooler, TEMP_COOLER_PIN));
+  TERN_(HAS_TEMP_ADC_BOARD,   UPDATE_RAW(temp_board, TEMP_BOARD_PIN));
+  TERN_(HAS_TEMP_ADC_SOC,     UPDATE_RAW(temp_soc, TEMP_SOC_PIN));
+
+  TERN_(HAS_JOY_ADC_X, UPDATE_RAW(joystick.x, JOY_X_PIN));
+  TERN_(HAS_JOY_ADC_Y, UPDATE_RAW(joystick.y, JOY_Y_PIN));
+  TERN_(HAS_JOY_ADC_Z, UPDATE_RAW(joystick.z, JOY_Z_PIN));
 }
 
 /**
@@ -3775,27 +3856,9 @@ public:
 };
 
 /**
- * Handle various ~1kHz tasks associated with temperature
- *  - Check laser safety timeout
- *  - Heater PWM (~1kHz with scaler)
- *  - LCD Button polling (~500Hz)
- *  - Start / Read one ADC sensor
- *  - Advance Babysteps
- *  - Endstop polling
- *  - Planner clean buffer
+ * Heater and fan software PWM, called on every Temperature ISR tick
  */
-void Temperature::isr() {
-
-  // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
-  #if LASER_SAFETY_TIMEOUT_MS > 0
-    if (cutter.last_power_applied && ELAPSED(millis(), gcode.previous_move_ms + (LASER_SAFETY_TIMEOUT_MS))) {
-      cutter.power = 0;       // Prevent planner idle from re-enabling power
-      cutter.apply_power(0);
-    }
-  #endif
-
-  static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
+void Temperature::soft_pwm_tick() {
 
   #ifndef SOFT_PWM_SCALE
     #define SOFT_PWM_SCALE 0
@@ -3805,11 +3868,6 @@ void Temperature::isr() {
   // Avoid multiple loads of pwm_count
   uint8_t pwm_count_tmp = pwm_count;
 
-  #if HAS_ADC_BUTTONS
-    static raw_adc_t raw_ADCKey_value = 0;
-    static bool ADCKey_pressed = false;
-  #endif
-
   #if HAS_HOTEND
     static SoftPWM soft_pwm_hotend[HOTENDS];
   #endif
@@ -4097,6 +4155,37 @@ void Temperature::isr() {
     }
 
   #endif // SLOW_PWM_HEATERS
+}
+
+/**
+ * Handle various ~1kHz tasks associated with temperature
+ *  - Check laser safety timeout
+ *  - Heater PWM (~1kHz with scaler)
+ *  - LCD Button polling (~500Hz)
+ *  - Start / Read one ADC sensor
+ *  - Advance Babysteps
+ *  - Endstop polling
+ *  - Planner clean buffer
+ */
+void Temperature::isr() {
+
+  // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
+  #if LASER_SAFETY_TIMEOUT_MS > 0
+    if (cutter.last_power_applied && ELAPSED(millis(), gcode.previous_move_ms + (LASER_SAFETY_TIMEOUT_MS))) {
+      cutter.power = 0;       // Prevent planner idle from re-enabling power
+      cutter.apply_power(0);
+    }
+  #endif
+
+  static int8_t temp_count = -1;
+  static ADCSensorState adc_sensor_state = StartupDelay;
+
+  #if HAS_ADC_BUTTONS
+    static raw_adc_t raw_ADCKey_value = 0;
+    static bool ADCKey_pressed = false;
+  #endif
+
+  soft_pwm_tick();
 
   //
   // Update lcd buttons 488 times per second
@@ -4104,6 +4193,33 @@ void Temperature::isr() {
   static bool do_buttons;
   if ((do_buttons ^= true)) ui.update_buttons();
 
+  //
+  // Additional ~1kHz Tasks
+  //
+
+  // Check fan tachometers
+  TERN_(HAS_FANCHECK, fan_check.update_tachometers());
+
+  // Poll endstops state, if required
+  endstops.poll();
+
+  // Periodically call the planner timer service routine
+  planner.isr();
+
+  #if ENABLED(CONTINUOUS_ADC_SAMPLING)
+    /**
+     * The HAL scans all the ADC pins in the background and oversamples them,
+     * so there is no sensor state machine. Take new readings at the same
+     * interval as the state machine would, keeping PID_dT and MPC_dT.
+     */
+    static uint16_t adc_ticks = 0;
+    if (++adc_ticks >= (OVERSAMPLENR) * (ACTUAL_ADC_SAMPLES)) {
+      adc_ticks = 0;
+      readings_ready();
+    }
+    return;
+  #endif
+
   /**
    * One sensor is sampled on every other call of the ISR.
    * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
@@ -4303,19 +4419,6 @@ void Temperature::isr() {
 
   // Go to the next state
   adc_sensor_state = next_sensor_state;
-
-  //
-  // Additional ~1kHz Tasks
-  //
-
-  // Check fan tachometers
-  TERN_(HAS_FANCHECK, fan_check.update_tachometers());
-
-  // Poll endstops state, if required
-  endstops.poll();
-
-  // Periodically call the planner timer service routine
-  planner.isr();
 }
 
 #if HAS_TEMP_SENSOR
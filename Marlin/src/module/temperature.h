@@ -590,6 +590,56 @@ typedef struct { raw_adc_t raw_min, raw_max; celsius_t mintemp, maxtemp; } temp_
 
 #endif
 
+#if ENABLED(THERMISTOR_DENSE_TABLE)
+
+  #if HAS_HEATED_BED && TEMP_SENSOR_BED_IS_THERMISTOR
+    #define HAS_DENSE_BED 1
+  #endif
+  #if HAS_TEMP_CHAMBER && TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+    #define HAS_DENSE_CHAMBER 1
+  #endif
+
+  /**
+   * Thermistor conversion by lookup in an evenly spaced table, with a power-of-2
+   * step so a reading converts with a shift and one multiply-add. An NTC thermistor
+   * is steepest at the low end of the raw range (the hot end) so the lowest eighth
+   * of the range has its own table with a step 8 times finer. Stored in 1/16 °C.
+   */
+  constexpr uint8_t dense_log2(const uint32_t n) { return n > 1 ? 1 + dense_log2(n >> 1) : 0; }
+
+  class DenseThermistorTable {
+  public:
+    static constexpr uint32_t RAW_RANGE = uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1;
+    static constexpr uint8_t STEP_BITS = dense_log2(RAW_RANGE / (THERMISTOR_DENSE_ENTRIES)),
+                             FINE_BITS = STEP_BITS - 3;
+    static constexpr uint32_t FINE_RANGE = RAW_RANGE / 8;
+    static_assert(STEP_BITS >= 3, "THERMISTOR_DENSE_ENTRIES is too large for the ADC resolution.");
+
+    // Sample an exact conversion at every table point
+    template<typename F>
+    void build(F exact) {
+      for (uint16_t i = 0; i <= (THERMISTOR_DENSE_ENTRIES); ++i) {
+        coarse[i] = fixed(exact(raw_adc_t(_MIN(uint32_t(i) << STEP_BITS, RAW_RANGE - 1))));
+        fine[i] = fixed(exact(raw_adc_t(uint32_t(i) << FINE_BITS)));
+      }
+    }
+
+    celsius_float_t celsius(const raw_adc_t raw) const {
+      const bool is_fine = raw < FINE_RANGE;
+      const uint8_t bits = is_fine ? FINE_BITS : STEP_BITS;
+      const int16_t * const t = (is_fine ? fine : coarse) + (raw >> bits);
+      const int32_t part = raw & (_BV(bits) - 1);
+      return (t[0] + ((int32_t(t[1] - t[0]) * part) >> bits)) * (1.0f / 16);
+    }
+
+  private:
+    int16_t coarse[(THERMISTOR_DENSE_ENTRIES) + 1], fine[(THERMISTOR_DENSE_ENTRIES) + 1];
+
+    static int16_t fixed(const celsius_float_t c) { return int16_t(LROUND(constrain(c, -2000, 2000) * 16)); }
+  };
+
+#endif // THERMISTOR_DENSE_TABLE
+
 #if HAS_AUTO_FAN || HAS_FANCHECK
   #define HAS_FAN_LOGIC 1
 #endif
@@ -815,6 +865,25 @@ class Temperature {
      * Static (class) methods
      */
 
+    #if ENABLED(THERMISTOR_DENSE_TABLE)
+      // Hotends with a thermistor, as bits
+      #define _DENSE_HOTEND_BIT(N) | (ENABLED(TEMP_SENSOR_##N##_IS_THERMISTOR) << N)
+      static constexpr uint8_t dense_hotends = 0 REPEAT(HOTENDS, _DENSE_HOTEND_BIT);
+      #undef _DENSE_HOTEND_BIT
+
+      #if HAS_HOTEND
+        static DenseThermistorTable dense_hotend[HOTENDS];
+      #endif
+      #if HAS_DENSE_BED
+        static DenseThermistorTable dense_bed;
+      #endif
+      #if HAS_DENSE_CHAMBER
+        static DenseThermistorTable dense_chamber;
+      #endif
+      static bool dense_tables_dirty;     // Rebuild the tables before the next conversion
+      static void build_dense_tables();
+    #endif
+
     #if HAS_USER_THERMISTORS
       static user_thermistor_t user_thermistor[USER_THERMISTORS];
       static void M305_report(const uint8_t t_index, const bool forReplay=true);
@@ -824,24 +893,28 @@ class Temperature {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        TERN_(THERMISTOR_DENSE_TABLE, dense_tables_dirty = true);
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
         if (!WITHIN(value, 1, 10000000)) return false;
         user_thermistor[t_index].res_25 = value;
         user_thermistor[t_index].pre_calc = true;
+        TERN_(THERMISTOR_DENSE_TABLE, dense_tables_dirty = true);
         return true;
       }
       static bool set_beta(int8_t t_index, float value) {
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].beta = value;
         user_thermistor[t_index].pre_calc = true;
+        TERN_(THERMISTOR_DENSE_TABLE, dense_tables_dirty = true);
         return true;
       }
       static bool set_sh_coeff(int8_t t_index, float value) {
         if (!WITHIN(value, -0.01f, 0.01f)) return false;
         user_thermistor[t_index].sh_c_coeff = value;
         user_thermistor[t_index].pre_calc = true;
+        TERN_(THERMISTOR_DENSE_TABLE, dense_tables_dirty = true);
         return true;
       }
     #endif
@@ -926,6 +999,7 @@ class Temperature {
      * Called from the Temperature ISR
      */
     static void isr();
+    static void soft_pwm_tick();
     static void readings_ready();
 
     /**
@@ -1415,6 +1415,80 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
   return nbyte;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read up to 'count' whole blocks from a block-aligned file position.
+   * Each run of contiguous blocks within a cluster is read with a single
+   * multi-block transfer. The last block of the file may be partial.
+   *
+   * \param[out] dst Pointer to the location that will receive the data.
+   * \param[in] count Maximum number of 512 byte blocks to read.
+   *
+   * \return For success readBlocks() returns the number of bytes read.
+   * A value less than \a count * 512 indicates that end of file was reached.
+   * If an error occurs, readBlocks() returns -1.
+   */
+  int16_t SdBaseFile::readBlocks(uint8_t * const dst, const uint8_t count) {
+    // Unaligned or fixed root directory reads go the usual way
+    if ((curPosition_ & 0x1FF) || type_ == FAT_FILE_TYPE_ROOT_FIXED)
+      return read(dst, uint16_t(count) << 9);
+
+    // error if not open or write only
+    if (!isOpen() || !(flags_ & O_READ)) return -1;
+
+    // Whole blocks left in the file
+    uint8_t blocks = count;
+    NOMORE(blocks, (fileSize_ - curPosition_) >> 9);
+
+    uint8_t *out = dst;
+    while (blocks) {
+      const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+      if (blockOfCluster == 0) {
+        // start of new cluster
+        if (curPosition_ == 0)
+          curCluster_ = firstCluster_;                      // use first cluster in file
+        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+          return -1;
+      }
+      const uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+      // Contiguous blocks up to the end of this cluster
+      uint8_t n = vol_->blocksPerCluster() - blockOfCluster;
+      NOMORE(n, blocks);
+
+      // The cached block may be newer than the card, so copy it from the cache
+      const uint32_t cached = vol_->cacheBlockNumber() - block;
+      if (cached == 0) {
+        memcpy(out, vol_->cache()->data, 512);
+        n = 1;
+      }
+      else {
+        if (cached < n) n = cached;   // Stop before the cached block
+        DiskIODriver * const card = vol_->sdCard();
+        if (!card->readStart(block)) return -1;
+        for (uint8_t i = 0; i < n; ++i)
+          if (!card->readData(out + (uint16_t(i) << 9))) { card->readStop(); return -1; }
+        if (!card->readStop()) return -1;
+      }
+      curPosition_ += uint32_t(n) << 9;
+      out += uint16_t(n) << 9;
+      blocks -= n;
+    }
+
+    // Partial last block of the file
+    const uint16_t left = (uint16_t(count) << 9) - (out - dst);
+    if (left && curPosition_ < fileSize_) {
+      const int16_t n = read(out, left);
+      if (n < 0) return -1;
+      out += n;
+    }
+
+    return out - dst;
+  }
+
+#endif // SD_READ_AHEAD
+
 /**
  * Read the next entry in a directory.
  *
@@ -296,6 +296,9 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void * const buf, uint16_t nbyte);
+  #if ENABLED(SD_READ_AHEAD)
+    int16_t readBlocks(uint8_t * const dst, const uint8_t count);
+  #endif
   int8_t readDir(dir_t * const dir, char * const longFilename);
   static bool remove(SdBaseFile * const dirFile, const char * const path);
   bool remove();
@@ -146,6 +146,12 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ra_buffer[SD_READ_AHEAD_BLOCKS * 512] __attribute__((aligned(4)));
+  uint32_t CardReader::ra_start;
+  uint16_t CardReader::ra_first, CardReader::ra_count;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -727,6 +733,13 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, ra_count = 0);
+
+    #if ENABLED(BINARY_GCODE)
+      // Pre-tokenized G-code files have the .GCB extension
+      const char * const ext = strrchr(fname, '.');
+      flag.binary_gcode = ext && strcasecmp_P(ext, PSTR(".GCB")) == 0;
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -741,6 +754,70 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     openFailed(fname);
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Drop the buffered blocks before sdpos and read as many of the following file
+   * blocks as will fit in the ring. If sdpos is outside of the buffered range the
+   * ring starts over at sdpos. Return 'true' if the byte at sdpos is buffered.
+   */
+  bool CardReader::read_ahead_fill() {
+    if (!file.isOpen()) return false;
+
+    constexpr uint16_t ring_size = sizeof(ra_buffer);
+
+    if (sdpos - ra_start > ra_count) {    // Seek or new file
+      ra_start = sdpos & ~uint32_t(0x1FF);
+      ra_first = ra_count = 0;
+    }
+    else while (sdpos - ra_start >= 512) { // Drop consumed blocks
+      ra_start += 512;
+      ra_first = (ra_first + 512) & (ring_size - 1);
+      ra_count -= 512;
+    }
+
+    // Read into the free space, up to the end of the ring. A partial block means
+    // the end of the file is already buffered.
+    const uint32_t pos = ra_start + ra_count;
+    const uint16_t wr = (ra_first + ra_count) & (ring_size - 1),
+                   space = _MIN(uint16_t(ring_size - ra_count), uint16_t(ring_size - wr));
+    if (space && !(ra_count & 0x1FF) && pos < filesize) {
+      thermalManager.pause_heaters(true);
+      const int16_t n = file.seekSet(pos) ? file.readBlocks(ra_buffer + wr, space >> 9) : -1;
+      thermalManager.pause_heaters(false);
+      if (n > 0) ra_count += n;
+    }
+
+    return sdpos - ra_start < ra_count;
+  }
+
+  /**
+   * Copy bytes from the read-ahead buffer, refilling it as needed
+   */
+  int16_t CardReader::read(void *buf, uint16_t nbyte) {
+    if (!file.isOpen()) return -1;
+    uint8_t *dst = (uint8_t*)buf;
+    uint16_t done = 0;
+    while (done < nbyte && (sdpos - ra_start < ra_count || read_ahead_fill())) {
+      const uint16_t offset = sdpos - ra_start,
+                     idx = (ra_first + offset) & (sizeof(ra_buffer) - 1),
+                     n = _MIN(uint16_t(nbyte - done), uint16_t(ra_count - offset), uint16_t(sizeof(ra_buffer) - idx));
+      memcpy(dst + done, ra_buffer + idx, n);
+      done += n;
+      sdpos += n;
+    }
+    return done;
+  }
+
+  /**
+   * Top up the read-ahead buffer from idle() while printing
+   */
+  void CardReader::read_ahead() {
+    if (IS_SD_FETCHING() && !flag.saving) read_ahead_fill();
+  }
+
+#endif // SD_READ_AHEAD
+
 inline void echo_write_to_file(const char * const fname) {
   SERIAL_ECHOLNPGM(STR_SD_WRITE_TO_FILE, fname);
 }
@@ -84,6 +84,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(BINARY_GCODE)
+         , binary_gcode:1
+       #endif
     ;
 } card_flags_t;
 
@@ -237,10 +240,21 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { thermalManager.pause_heaters(true); int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); thermalManager.pause_heaters(false); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { thermalManager.pause_heaters(true); int16_t out = file.isOpen() ? file.read(buf, nbyte) : -1; thermalManager.pause_heaters(false); return out;}
+  #if ENABLED(SD_READ_AHEAD)
+    // Reads come from the read-ahead buffer, which is only refilled as needed
+    static int16_t get() {
+      if (sdpos - ra_start >= ra_count && !read_ahead_fill()) return -1;
+      return ra_buffer[(ra_first + uint16_t(sdpos++ - ra_start)) & (sizeof(ra_buffer) - 1)];
+    }
+    static int16_t read(void *buf, uint16_t nbyte);
+    static void setIndex(const uint32_t index)    { sdpos = index; }
+    static void read_ahead();
+  #else
+    static int16_t get()                            { thermalManager.pause_heaters(true); int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); thermalManager.pause_heaters(false); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { thermalManager.pause_heaters(true); int16_t out = file.isOpen() ? file.read(buf, nbyte) : -1; sdpos = file.curPosition(); thermalManager.pause_heaters(false); return out;}
+    static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { thermalManager.pause_heaters(true); int16_t out = file.isOpen() ? file.write(buf, nbyte) : -1; thermalManager.pause_heaters(false); return out;}
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -333,6 +347,14 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_READ_AHEAD)
+    static uint8_t ra_buffer[SD_READ_AHEAD_BLOCKS * 512]; // Ring of file blocks read ahead of sdpos
+    static uint32_t ra_start;                             // File position of the oldest buffered block
+    static uint16_t ra_first,                             // Ring offset of the oldest buffered block
+                    ra_count;                             // Bytes buffered from ra_start
+    static bool read_ahead_fill();
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -0,0 +1,136 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(BINARY_GCODE)
+
+#include <src/gcode/parser.h>
+#include <src/gcode/binary_gcode.h>
+
+// Build a pre-parsed record the way gcode2gcb.py does. Values are given in letter order.
+static uint8_t make_record(uint8_t * const rec, const char letter, const uint16_t codenum, const uint8_t subcode,
+                           const char * const letters, const char * const valued, const float * const values) {
+  uint32_t codebits = 0, valuebits = 0;
+  for (const char *c = letters; *c; ++c) SBI32(codebits, *c - 'A');
+  for (const char *c = valued; *c; ++c) SBI32(valuebits, *c - 'A');
+  rec[0] = BINARY_GCODE_CMD;
+  rec[1] = letter;
+  rec[2] = uint8_t(codenum);
+  rec[3] = uint8_t(codenum >> 8);
+  rec[4] = subcode;
+  memcpy(&rec[5], &codebits, sizeof(codebits));
+  memcpy(&rec[9], &valuebits, sizeof(valuebits));
+  const uint8_t n = strlen(valued);
+  if (n) memcpy(&rec[BINARY_GCODE_VALUES], values, n * sizeof(float));
+  return BINARY_GCODE_VALUES + n * sizeof(float);
+}
+
+MARLIN_TEST(binary_gcode, parse_move) {
+  const float values[] = { 0.0432109f, 1500.0f, 10.0f, -2.5f };
+  uint8_t rec[MAX_CMD_SIZE];
+  const uint8_t len = make_record(rec, 'G', 1, 0, "EFXY", "EFXY", values);
+  TEST_ASSERT_TRUE(binary_gcode_valid(rec, len));
+
+  // The parser reads the record as queued, with the exact float32 values
+  parser.parse((char*)rec);
+  TEST_ASSERT_EQUAL('G', parser.command_letter);
+  TEST_ASSERT_EQUAL(1, parser.codenum);
+  TEST_ASSERT_TRUE(parser.seen('Y'));
+  TEST_ASSERT_EQUAL_FLOAT(-2.5f, parser.value_float());
+  TEST_ASSERT_TRUE(parser.seen('E'));
+  TEST_ASSERT_EQUAL_FLOAT(0.0432109f, parser.value_float());
+  TEST_ASSERT_TRUE(parser.seen('F'));
+  TEST_ASSERT_EQUAL(1500, parser.value_long());
+  TEST_ASSERT_FALSE(parser.seen('Z'));
+}
+
+MARLIN_TEST(binary_gcode, parse_flags_and_subcode) {
+  uint8_t rec[MAX_CMD_SIZE];
+  const uint8_t len = make_record(rec, 'G', 29, 1, "SX", "", nullptr);
+  TEST_ASSERT_TRUE(binary_gcode_valid(rec, len));
+
+  parser.parse((char*)rec);
+  TEST_ASSERT_EQUAL('G', parser.command_letter);
+  TEST_ASSERT_EQUAL(29, parser.codenum);
+  #if USE_GCODE_SUBCODES
+    TEST_ASSERT_EQUAL(1, parser.subcode);
+  #endif
+  TEST_ASSERT_TRUE(parser.seen('S'));
+  TEST_ASSERT_FALSE(parser.has_value());
+  TEST_ASSERT_TRUE(parser.seen('X'));
+  TEST_ASSERT_FALSE(parser.seen('Y'));
+}
+
+MARLIN_TEST(binary_gcode, parse_text_after_binary) {
+  const float value = 210.0f;
+  uint8_t rec[MAX_CMD_SIZE];
+  make_record(rec, 'M', 104, 0, "S", "S", &value);
+  parser.parse((char*)rec);
+
+  // A text command after a pre-parsed one reads its values as text
+  char cmd[] = "G1 X1.5";
+  parser.parse(cmd);
+  TEST_ASSERT_TRUE(parser.seen('X'));
+  TEST_ASSERT_EQUAL_FLOAT(1.5f, parser.value_float());
+  TEST_ASSERT_FALSE(parser.seen('S'));
+}
+
+MARLIN_TEST(binary_gcode, parse_out_of_range_integers) {
+  const float values[] = { -5.0f, 1e10f };
+  uint8_t rec[MAX_CMD_SIZE];
+  make_record(rec, 'G', 4, 0, "PS", "PS", values);
+  parser.parse((char*)rec);
+
+  // Values that don't fit the integer type are clamped to it
+  TEST_ASSERT_TRUE(parser.seen('P'));
+  TEST_ASSERT_EQUAL(0UL, parser.value_ulong());
+  TEST_ASSERT_EQUAL(-5L, parser.value_long());
+  TEST_ASSERT_TRUE(parser.seen('S'));
+  TEST_ASSERT_EQUAL(4294967040UL, parser.value_ulong());
+  TEST_ASSERT_EQUAL(2147483520L, parser.value_long());
+}
+
+MARLIN_TEST(binary_gcode, reject_malformed) {
+  const float values[] = { 1.0f, 2.0f };
+  uint8_t rec[MAX_CMD_SIZE];
+
+  // Missing and extra value bytes
+  uint8_t len = make_record(rec, 'G', 0, 0, "XY", "XY", values);
+  TEST_ASSERT_FALSE(binary_gcode_valid(rec, len - 1));
+  TEST_ASSERT_FALSE(binary_gcode_valid(rec, len + 1));
+
+  // A value for a letter that isn't present
+  len = make_record(rec, 'G', 0, 0, "X", "XY", values);
+  TEST_ASSERT_FALSE(binary_gcode_valid(rec, len));
+
+  // An unknown command letter
+  len = make_record(rec, 'Q', 0, 0, "", "", nullptr);
+  TEST_ASSERT_FALSE(binary_gcode_valid(rec, len));
+
+  // A value that isn't a number
+  const float nan_value = NAN;
+  len = make_record(rec, 'M', 104, 0, "S", "S", &nan_value);
+  TEST_ASSERT_FALSE(binary_gcode_valid(rec, len));
+}
+
+#endif // BINARY_GCODE
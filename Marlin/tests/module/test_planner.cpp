@@ -0,0 +1,191 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/module/planner.h>
+
+#if ENABLED(TRAPEZOID_INTEGER_MATH)
+
+#include <math.h>
+
+// Small deterministic generator so the comparisons cover a spread of values
+static uint32_t next_rand(uint32_t &seed) { return (seed = seed * 1664525UL + 1013904223UL) >> 8; }
+
+MARLIN_TEST(planner, trap_isqrt) {
+  TEST_ASSERT_EQUAL(0, trap_isqrt(uint32_t(0)));
+  TEST_ASSERT_EQUAL(1, trap_isqrt(uint32_t(3)));
+  TEST_ASSERT_EQUAL(2, trap_isqrt(uint32_t(4)));
+  TEST_ASSERT_EQUAL(65535, trap_isqrt(uint32_t(UINT32_MAX)));
+  TEST_ASSERT_EQUAL(100000, trap_isqrt(uint64_t(10000000000ULL)));
+  TEST_ASSERT_EQUAL(99999, trap_isqrt(uint64_t(9999999999ULL)));
+}
+
+MARLIN_TEST(planner, trap_accel_steps_matches_float) {
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < 1000; ++i) {
+    const uint32_t r1 = 100 + next_rand(seed) % (i & 1 ? 60000 : 250000),
+                   r0 = 100 + next_rand(seed) % (r1 - 99),
+                   accel = 50 + next_rand(seed) % 400000;
+    uint32_t rem;
+    const uint32_t steps = trap_accel_steps(r1, r0, accel, rem);
+    const double exact = (double(r1) * r1 - double(r0) * r0) / (2.0 * accel);
+    TEST_ASSERT_EQUAL(uint32_t(floor(exact)), steps);
+    TEST_ASSERT_TRUE(rem < accel * 2);
+    TEST_ASSERT_EQUAL(uint32_t(ceil(exact)), steps + (rem != 0));
+  }
+}
+
+MARLIN_TEST(planner, trap_final_rate_matches_float) {
+  uint32_t seed = 2;
+  for (uint16_t i = 0; i < 1000; ++i) {
+    const uint32_t r0 = 100 + next_rand(seed) % 40000,
+                   accel = 50 + next_rand(seed) % 400000,
+                   steps = next_rand(seed) % 20000;
+    const float speed = SQRT(sq(float(r0)) + 2 * float(accel) * steps);
+    const uint32_t rate = trap_final_rate(r0, accel, steps);
+    // The float path loses precision at high rates, so allow a small relative error
+    TEST_ASSERT_UINT32_WITHIN(uint32_t(speed * 1e-5f) + 1, uint32_t(speed), rate);
+  }
+}
+
+MARLIN_TEST(planner, trap_accel_ticks_matches_64bit) {
+  uint32_t seed = 4;
+  for (uint16_t i = 0; i < 1000; ++i) {
+    const uint32_t dr = next_rand(seed) % (i & 1 ? 60000 : 250000),
+                   accel = 1000 + next_rand(seed) % 4000000;
+    TEST_ASSERT_EQUAL(uint32_t(uint64_t(STEPPER_TIMER_RATE) * dr / accel), trap_accel_ticks(dr, accel));
+  }
+}
+
+// Test access to the planner's private trapezoid calculation
+class PlannerTest {
+  public:
+  static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
+    Planner::calculate_trapezoid_for_block(block, entry_speed, exit_speed);
+  }
+};
+
+// The trapezoid the float math gives a block, for rates already within limits
+struct float_trapezoid_t { uint32_t accelerate_before, decelerate_start; };
+static float_trapezoid_t float_trapezoid(const block_t &block, const uint32_t initial_rate, const uint32_t final_rate) {
+  const int32_t steps = block.step_event_count;
+  int32_t accelerate_steps = 0, decelerate_steps = 0;
+  const float half_inverse_accel = 0.5f / block.acceleration_steps_per_s2,
+              nominal_rate_sq = sq(float(block.nominal_rate)),
+              decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate))),
+              accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+  accelerate_steps = CEIL(accelerate_steps_float);
+  decelerate_steps = CEIL(decelerate_steps_float);
+  if (steps - accelerate_steps - decelerate_steps < 0) {
+    accelerate_steps = LROUND((steps + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+    LIMIT(accelerate_steps, 0, steps);
+    decelerate_steps = steps - accelerate_steps;
+  }
+  return { uint32_t(accelerate_steps), uint32_t(steps - decelerate_steps) };
+}
+
+// Run calculate_trapezoid_for_block and compare it with the float math
+static void check_trapezoid(const uint32_t steps, const uint32_t nominal_rate, const uint32_t accel,
+                            const uint32_t initial_rate, const uint32_t final_rate) {
+  block_t block;
+  memset((void*)&block, 0, sizeof(block));
+  block.steps_per_mm = 100;
+  block.step_event_count = steps;
+  block.nominal_rate = nominal_rate;
+  block.acceleration_steps_per_s2 = accel;
+
+  // Speeds that give the rates exactly
+  PlannerTest::calculate_trapezoid_for_block(&block, initial_rate / 100.0f, final_rate / 100.0f);
+  const float_trapezoid_t ft = float_trapezoid(block, initial_rate, final_rate);
+
+  TEST_ASSERT_EQUAL(initial_rate, block.initial_rate);
+  TEST_ASSERT_EQUAL(final_rate, block.final_rate);
+  // Float rounding may put an exact boundary one step either way
+  TEST_ASSERT_UINT32_WITHIN(1, ft.accelerate_before, block.accelerate_before);
+  TEST_ASSERT_UINT32_WITHIN(1, ft.decelerate_start, block.decelerate_start);
+  TEST_ASSERT_TRUE(block.accelerate_before <= block.decelerate_start);
+  TEST_ASSERT_TRUE(block.decelerate_start <= steps);
+}
+
+MARLIN_TEST(planner, trapezoid_matches_float) {
+  check_trapezoid(10000,  20000,  100000,  2000,  1000);  // Accelerate, cruise, decelerate
+  check_trapezoid(  500,  40000,   50000,  1000,  1000);  // No cruise
+  check_trapezoid(  501,  40000,   50000,  1000,  3000);  // No cruise, odd split
+  check_trapezoid( 4000,  10000,   20000,   500, 10000);  // Accelerate and cruise
+  check_trapezoid( 4000,  10000,   20000, 10000,   500);  // Cruise and decelerate
+  check_trapezoid( 3000,   5000,   40000,  5000,  5000);  // Cruise only
+  check_trapezoid(50000, 200000, 2000000,  3000,  3000);  // Rates beyond 16 bits
+  check_trapezoid(   10, 200000, 4000000, 150000, 120);   // Short block at a high rate
+
+  uint32_t seed = 3;
+  for (uint16_t i = 0; i < 1000; ++i) {
+    const uint32_t nominal_rate = 200 + next_rand(seed) % (i & 1 ? 60000 : 250000),
+                   accel = 1000 + next_rand(seed) % 400000,
+                   steps = 1 + next_rand(seed) % 20000,
+                   initial_rate = 120 + next_rand(seed) % (nominal_rate - 119),
+                   final_rate = 120 + next_rand(seed) % (nominal_rate - 119);
+    check_trapezoid(steps, nominal_rate, accel, initial_rate, final_rate);
+  }
+}
+
+#endif // TRAPEZOID_INTEGER_MATH
+
+#if ENABLED(MPC_FEED_FORWARD)
+
+// Queue a move block with the given E steps and direction
+static void queue_e_block(const uint32_t esteps, const bool forward, const float mm, const float speed) {
+  block_t * const block = &Planner::block_buffer[Planner::block_buffer_head];
+  memset((void*)block, 0, sizeof(block_t));
+  block->steps.e = esteps;
+  block->step_event_count = esteps;
+  block->direction_bits.e = forward;
+  block->millimeters = mm;
+  block->nominal_speed = speed;
+  Planner::block_buffer_head = block_inc_mod(Planner::block_buffer_head, 1);
+}
+
+MARLIN_TEST(planner, planned_e_speed_skips_retractions) {
+  #if ENABLED(EDITABLE_STEPS_PER_UNIT)
+    Planner::mm_per_step[E_AXIS] = 0.01f;
+  #endif
+  const float mm_per_step = Planner::mm_per_step[E_AXIS];
+
+  Planner::clear_block_buffer();
+  TEST_ASSERT_TRUE(isnan(Planner::planned_e_speed(0, 10)));
+
+  queue_e_block(1000, true, 20, 40);   // Extrude 1000 steps over 0.5s
+  queue_e_block(500, false, 5, 25);    // Retract 500 steps over 0.2s
+  queue_e_block(0, false, 30, 100);    // Travel for 0.3s
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1000 * mm_per_step, Planner::planned_e_speed(0, 10));
+
+  // Only the extrusion fits in the time limit
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1000 * mm_per_step / 0.5f, Planner::planned_e_speed(0, 0.1f));
+
+  // A retraction alone is no extrusion
+  Planner::clear_block_buffer();
+  queue_e_block(500, false, 5, 25);
+  TEST_ASSERT_EQUAL_FLOAT(0, Planner::planned_e_speed(0, 10));
+
+  Planner::clear_block_buffer();
+}
+
+#endif // MPC_FEED_FORWARD
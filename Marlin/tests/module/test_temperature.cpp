@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(THERMISTOR_DENSE_TABLE)
+
+#include <src/module/temperature.h>
+
+// Worst error allowed for the dense tables over the printing range
+#define DENSE_MAX_ERROR 1.0f
+
+// Compare a dense table with the exact conversion for every raw value between 20°C and 300°C
+template<typename F>
+static void check_dense_table(const DenseThermistorTable &table, F exact) {
+  for (uint32_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; ++raw) {
+    const celsius_float_t c = exact(raw_adc_t(raw));
+    if (WITHIN(c, 20, 300))
+      TEST_ASSERT_FLOAT_WITHIN(DENSE_MAX_ERROR, c, table.celsius(raw_adc_t(raw)));
+  }
+}
+
+MARLIN_TEST(temperature, dense_table_hotends) {
+  thermalManager.build_dense_tables();
+  TEST_ASSERT_FALSE(thermalManager.dense_tables_dirty);
+  #if HAS_HOTEND
+    HOTEND_LOOP() if (TEST(thermalManager.dense_hotends, e))
+      check_dense_table(thermalManager.dense_hotend[e], [e](const raw_adc_t raw) { return thermalManager.analog_to_celsius_hotend(raw, e); });
+  #endif
+}
+
+MARLIN_TEST(temperature, dense_table_bed_chamber) {
+  thermalManager.build_dense_tables();
+  #if HAS_DENSE_BED
+    check_dense_table(thermalManager.dense_bed, thermalManager.analog_to_celsius_bed);
+  #endif
+  #if HAS_DENSE_CHAMBER
+    check_dense_table(thermalManager.dense_chamber, thermalManager.analog_to_celsius_chamber);
+  #endif
+}
+
+MARLIN_TEST(temperature, dense_table_points) {
+  thermalManager.build_dense_tables();
+  #if HAS_HOTEND
+    // Table points convert within rounding to 1/16°C
+    HOTEND_LOOP() if (TEST(thermalManager.dense_hotends, e)) {
+      for (uint32_t raw = 0; raw < DenseThermistorTable::FINE_RANGE; raw += _BV(DenseThermistorTable::FINE_BITS))
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, thermalManager.analog_to_celsius_hotend(raw, e), thermalManager.dense_hotend[e].celsius(raw));
+      for (uint32_t raw = DenseThermistorTable::FINE_RANGE; raw < DenseThermistorTable::RAW_RANGE; raw += _BV(DenseThermistorTable::STEP_BITS))
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, thermalManager.analog_to_celsius_hotend(raw, e), thermalManager.dense_hotend[e].celsius(raw));
+    }
+  #endif
+}
+
+#endif // THERMISTOR_DENSE_TABLE
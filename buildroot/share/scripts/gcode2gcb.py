@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# gcode2gcb.py
+# Convert a G-code file into pre-tokenized binary G-code (.GCB) for BINARY_GCODE.
+# See Marlin/src/gcode/binary_gcode.h for the format.
+#
+# Usage: gcode2gcb.py [-s MAX_CMD_SIZE] [-c Configuration_adv.h] input.gcode [output.gcb]
+#
+# MAX_CMD_SIZE must match the firmware. By default it's read from the given
+# configuration file, or from Marlin/Configuration_adv.h in this repository.
+#
+import argparse, os, re, struct, sys
+
+MAGIC = b'MGCB'
+VERSION = 1
+CMD = 0x01
+DEFAULT_MAX_CMD_SIZE = 96
+
+# Commands taking a string argument, or handled before parsing, stay as text
+TEXT_CODES = { ('M', n) for n in (16, 23, 25, 28, 30, 32, 117, 118, 808, 928, *range(810, 820)) }
+
+CMD_RE = re.compile(r'([GMT])(\d+)(?:\.(\d+))?$')
+PARAM_RE = re.compile(r'([A-Z])([-+]?(?:\d+\.?\d*|\.\d+))?$')
+
+class LineTooLong(Exception): pass
+
+def config_max_cmd_size(path):
+    """Read MAX_CMD_SIZE from a configuration file"""
+    with open(path, 'r', errors='replace') as f:
+        for line in f:
+            m = re.match(r'\s*#define\s+MAX_CMD_SIZE\s+(\d+)', line)
+            if m: return int(m.group(1))
+    return DEFAULT_MAX_CMD_SIZE
+
+def strip_line(line):
+    line = re.sub(r'\([^)]*\)', '', line.split(';', 1)[0])
+    line = line.split('*', 1)[0].strip()
+    return re.sub(r'^N\d+\s*', '', line)
+
+def encode(line, max_cmd_size):
+    """Return a binary record for the line or None to keep it as text"""
+    words = line.split()
+    m = CMD_RE.match(words[0])
+    if not m: return None
+    letter, code, sub = m.group(1), int(m.group(2)), int(m.group(3) or 0)
+    if (letter, code) in TEXT_CODES or code > 0xFFFF or sub > 0xFF: return None
+    params = {}
+    for w in words[1:]:
+        p = PARAM_RE.match(w)
+        if not p or p.group(1) in params: return None
+        params[p.group(1)] = p.group(2)
+    codebits = valuebits = 0
+    values = b''
+    for ltr in sorted(params):
+        bit = 1 << (ord(ltr) - ord('A'))
+        codebits |= bit
+        if params[ltr] is not None:
+            v = struct.pack('<f', float(params[ltr]))
+            if not abs(struct.unpack('<f', v)[0]) < 1e9: return None
+            valuebits |= bit
+            values += v
+    rec = struct.pack('<BBHBII', CMD, ord(letter), code, sub, codebits, valuebits) + values
+    return rec if len(rec) < max_cmd_size else None
+
+def convert(infile, outfile, max_cmd_size):
+    with open(infile, 'r', errors='replace') as fin, open(outfile, 'wb') as fout:
+        fout.write(MAGIC + bytes([VERSION]))
+        for lineno, raw in enumerate(fin, 1):
+            line = strip_line(raw)
+            if not line: continue
+            rec = encode(line.upper(), max_cmd_size) or line.encode()
+            if len(rec) >= min(max_cmd_size, 256):
+                raise LineTooLong("%s:%d: Command is longer than MAX_CMD_SIZE (%d): %s" % (infile, lineno, max_cmd_size, line))
+            fout.write(bytes([len(rec)]) + rec)
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    default_config = os.path.join(here, '..', '..', '..', 'Marlin', 'Configuration_adv.h')
+
+    ap = argparse.ArgumentParser(description="Convert G-code into pre-tokenized binary G-code (.GCB)")
+    ap.add_argument('-s', '--max-cmd-size', type=int, help="MAX_CMD_SIZE of the firmware")
+    ap.add_argument('-c', '--config', default=default_config, help="Configuration_adv.h to read MAX_CMD_SIZE from")
+    ap.add_argument('input')
+    ap.add_argument('output', nargs='?')
+    args = ap.parse_args()
+
+    max_cmd_size = args.max_cmd_size
+    if max_cmd_size is None:
+        max_cmd_size = config_max_cmd_size(args.config) if os.path.isfile(args.config) else DEFAULT_MAX_CMD_SIZE
+
+    dst = args.output or re.sub(r'\.[^.]*$', '', args.input) + '.gcb'
+    try:
+        convert(args.input, dst, max_cmd_size)
+    except LineTooLong as e:
+        os.remove(dst)
+        print("Error: " + str(e), file=sys.stderr)
+        sys.exit(1)
+
+if __name__ == '__main__':
+    main()